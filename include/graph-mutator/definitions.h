@@ -120,12 +120,35 @@ inline constexpr bool print_edges {true};
 /// Toggles integral testing on and off.
 inline constexpr bool integral_testing {true};
 
+/// Transforms refresh graph books only for the chains they have modified.
+/// If false, every update rebuilds the books over the whole graph.
+inline constexpr bool incremental_books {true};
+
+/// Default of Graph::split_smaller_side: component splits move the smaller
+/// of the separated sides to the new component, so that their cost is
+/// proportional to it. If false, the side beyond the cut slot always forms
+/// the new component, which requires reindexing the whole component.
+inline constexpr bool smaller_side_splits {false};
+
+/// Slots store the host index and the location each in 32 bits, so that
+/// a slot occupies a single 64-bit word. Requires fewer than 2^32 - 1 chains
+/// and edges per chain.
+inline constexpr bool packed_slots {false};
+
+/// Edge, chain and component ids are 32-bit, which halves the size of the
+/// edges and of the graph-wide index maps. Requires fewer than 2^32 - 1
+/// edges in the graph.
+inline constexpr bool narrow_ids {false};
+
 // Typenames for ids of structural elements and theirr containers.
 
 using itT = std::uint_fast64_t;  ///< Type for counting simulation iterations.
-using EgId = szt;  ///< Edge ids.
-using ChId = szt;  ///< Chain ids.
-using CmpId = szt;  ///< Component ids.
+/// Underlying type of the structural element ids.
+using Idx = std::conditional_t<narrow_ids, std::uint32_t, szt>;
+
+using EgId = Idx;  ///< Edge ids.
+using ChId = Idx;  ///< Chain ids.
+using CmpId = Idx;  ///< Component ids.
 
 using ChIds = std::vector<ChId>;  ///< Container for chain ids.
 using EgIds = std::vector<EgId>;  ///< Container for edge ids.
@@ -182,7 +205,7 @@ Msgr& operator<<(Msgr& msgr, T... values)
 
 // array from std::integer_sequence, based on
 //https://stackoverflow.com/questions/41660062/how-to-construct-an-stdarray-with-index-sequence
-template<typename T, std::size_t N, std::size_t... I>
+template<typename T, std::size_t N, T... I>
 consteval auto create_array_impl(std::integer_sequence<T, I...>)
 {
     return std::array<T, N>{ {I...} };
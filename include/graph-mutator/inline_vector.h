@@ -0,0 +1,168 @@
+/* =============================================================================
+
+Copyright (c) 2021-2025 Valerii Sukhorukov <vsukhorukov@yahoo.com>
+All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+================================================================================
+*/
+
+/**
+ * @file inline_vector.h
+ * @brief Contains definition of a fixed-capacity sequence container.
+ * @author Valerii Sukhorukov
+ */
+
+#ifndef GRAPH_MUTATOR_INLINE_VECTOR_H
+#define GRAPH_MUTATOR_INLINE_VECTOR_H
+
+#include <algorithm>  // equal, move
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <utility>    // move
+
+#include "definitions.h"
+
+
+namespace graph_mutator {
+
+/**
+ * @brief Sequence container storing up to \p N elements in place.
+ * @details Has the interface of std::vector used for short lists, but keeps
+ * the elements in a member array and their number in a single byte, so that
+ * no heap allocation is involved and copies are plain memory copies.
+ * @tparam T Type of elements; must be default-constructible.
+ * @tparam N Capacity.
+ */
+template<typename T,
+         std::size_t N>
+class InlineVector {
+
+    static_assert(N <= std::numeric_limits<std::uint8_t>::max());
+
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr InlineVector() noexcept = default;
+
+    constexpr InlineVector(std::initializer_list<T> il);
+
+    static constexpr auto capacity() noexcept -> size_type { return N; }
+
+    constexpr auto size() const noexcept -> size_type { return n; }
+    constexpr auto empty() const noexcept -> bool { return !n; }
+
+    constexpr auto operator[](size_type i) noexcept -> reference { return a[i]; }
+    constexpr auto operator[](size_type i) const noexcept -> const_reference { return a[i]; }
+
+    constexpr auto front() noexcept -> reference { return a[0]; }
+    constexpr auto front() const noexcept -> const_reference { return a[0]; }
+    constexpr auto back() noexcept -> reference { return a[n-1]; }
+    constexpr auto back() const noexcept -> const_reference { return a[n-1]; }
+
+    constexpr auto begin() noexcept -> iterator { return a.data(); }
+    constexpr auto begin() const noexcept -> const_iterator { return a.data(); }
+    constexpr auto end() noexcept -> iterator { return a.data() + n; }
+    constexpr auto end() const noexcept -> const_iterator { return a.data() + n; }
+    constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+    constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+    constexpr void clear() noexcept { n = 0; }
+
+    constexpr void push_back(const T& v);
+    constexpr void push_back(T&& v);
+
+    constexpr auto erase(const_iterator pos) -> iterator;
+
+    /// Compares the elements in use only.
+    friend constexpr auto operator==(const InlineVector& u,
+                                     const InlineVector& v) -> bool
+    {
+        return std::equal(u.begin(), u.end(), v.begin(), v.end());
+    }
+
+private:
+
+    std::array<T, N> a {};  ///< Storage.
+    std::uint8_t n {};      ///< Number of elements in use.
+};
+
+
+// IMPLEMENTATION ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+template<typename T,
+         std::size_t N>
+constexpr
+InlineVector<T, N>::
+InlineVector(std::initializer_list<T> il)
+{
+    ASSERT(il.size() <= N, "InlineVector: ", il.size(),
+           " elements exceed capacity ", N);
+
+    for (const auto& v: il)
+        a[n++] = v;
+}
+
+
+template<typename T,
+         std::size_t N>
+constexpr
+void InlineVector<T, N>::
+push_back(const T& v)
+{
+    ASSERT(n < N, "InlineVector: push_back() beyond capacity ", N);
+
+    a[n++] = v;
+}
+
+
+template<typename T,
+         std::size_t N>
+constexpr
+void InlineVector<T, N>::
+push_back(T&& v)
+{
+    ASSERT(n < N, "InlineVector: push_back() beyond capacity ", N);
+
+    a[n++] = std::move(v);
+}
+
+
+template<typename T,
+         std::size_t N>
+constexpr
+auto InlineVector<T, N>::
+erase(const const_iterator pos) -> iterator
+{
+    const auto p = begin() + (pos - begin());
+    std::move(p + 1, end(), p);
+    --n;
+
+    return p;
+}
+
+
+}  // namespace graph_mutator
+
+#endif  // GRAPH_MUTATOR_INLINE_VECTOR_H
@@ -32,6 +32,8 @@ limitations under the License.
 
 #include <algorithm>
 #include <array>
+#include <iterator>  // make_move_iterator
+#include <ranges>    // views::reverse
 #include <string>
 #include <vector>
 
@@ -97,6 +99,15 @@ struct Chain {
     /// Index of the disconnected component the chain bleongs to.
     CmpId c {undefined<CmpId>};
 
+    /// Graph-wide edge-to-chain map kept current by the edge primitives.
+    /// Not owned; nullptr if the chain is not bound to a graph. Copies of
+    /// the chain start unbound, while moves keep the binding.
+    ChIds* glm {};
+
+    /// Graph-wide edge-to-position map kept current by the edge primitives.
+    /// Not owned; nullptr if the chain is not bound to a graph.
+    EgIds* gla {};
+
     /**
      * @brief Empty chain constructor without component specs.
      * @param idw Graph-wide index of of this chain.
@@ -135,9 +146,9 @@ struct Chain {
 
     constexpr Chain() = default;
     constexpr explicit Chain(const Chain& other);
-    constexpr explicit Chain(Chain&& other);
+    constexpr explicit Chain(Chain&& other) noexcept;
     constexpr auto operator=(const Chain& other) -> Chain&;
-    constexpr auto operator=(Chain&& other) -> Chain&;
+    constexpr auto operator=(Chain&& other) noexcept -> Chain&;
     ~Chain() = default;
 
     constexpr auto operator==(const Chain& other) const noexcept -> bool;
@@ -385,6 +396,13 @@ struct Chain {
      */
     constexpr auto length() const noexcept -> EgId;
 
+    /**
+     * @brief Checks if the chain is a vacant slot of the graph chains.
+     * @details Chains removed from a graph keeping chain ids are left in
+     * place devoid of edges and connections: see Graph::vacate_chain().
+     */
+    constexpr auto is_vacant() const noexcept -> bool;
+
     /**
      * @brief Reports the total weight of the chain edges.
      * @details The chain weight is equal to the sum of the weights of all edges
@@ -431,6 +449,26 @@ struct Chain {
     constexpr void set_g_w(Id w) noexcept;
     constexpr void set_g_w() noexcept;
 
+    /**
+     * @brief Binds graph-wide edge index maps to be updated by this chain.
+     * @details Once bound, insert_edge(), remove_edge(), append_edge(),
+     * append_reversed(), reverse_g() and set_g_w() record the new chain and
+     * position of the edges they move in \p glm and \p gla.
+     * @param glm Mapping of graph-wide edge indexes to chain indexes.
+     * @param gla Mapping of graph-wide edge indexes to positions inside chains.
+     */
+    constexpr void bind_indma(ChIds& glm, EgIds& gla) noexcept;
+
+    /// Checks if the chain updates maps \p glm and \p gla.
+    constexpr auto is_bound_to(const ChIds& glm,
+                               const EgIds& gla) const noexcept -> bool;
+
+    /**
+     * @brief Records edges g[a], g[a+1], ... in the bound edge index maps.
+     * @param a Position of the first edge to record.
+     */
+    constexpr void set_indma(EgId a=0) noexcept;
+
     constexpr auto dir_char(EgId a) const noexcept -> char;
 
     /**
@@ -452,12 +490,35 @@ struct Chain {
     */
     auto remove_edge(EgId a) -> Edge*;
 
+    /**
+     * @brief Inserts edges \p ee at g[a], g[a+1], ... .
+     * @note Original edges g[a], g[a+1], ... are shifted forwards by the
+     * number of edges inserted.
+     */
+    void insert_edges(Edges&& ee, EgId a);
+
+    /**
+     * @brief Removes \p n edges starting at position \p a .
+     * @details Original edges g[a+n], g[a+n+1], ... are shifted backwards,
+     * becoming g[a], g[a+1], ... .
+     * @return The removed edges in their original order.
+     */
+    auto remove_edges(EgId a, EgId n) -> Edges;
+
     /**
      * @brief Appends an edge at the chain head, i.e. at the back of g.
      * @param e Edge to be appended.
      */
     void append_edge(Edge&& e);
 
+    /**
+     * @brief Appends edges \p ee in the reverse order, reflecting each one.
+     * @details Is equivalent to reverse_g() of the chain holding \p ee
+     * followed by appending its edges, but only the appended edges are
+     * visited, and each of them once.
+     */
+    void append_reversed(Edges&& ee);
+
     /**
      * @brief Prints neighbor data on both ends.
      * @param tag Short description.
@@ -529,12 +590,14 @@ Chain(
 template<typename E4>
 constexpr
 Chain<E4>::
-Chain(Chain&& other)
+Chain(Chain&& other) noexcept
     : g {std::move(other.g)}
     , ngs {std::move(other.ngs)}
     , idw {std::move(other.idw)}
     , idc {std::move(other.idc)}
     , c {std::move(other.c)}
+    , glm {other.glm}
+    , gla {other.gla}
 {}
 
 
@@ -547,19 +610,23 @@ Chain(const Chain& other)
     , idw {other.idw}
     , idc {other.idc}
     , c {other.c}
+    , glm {}
+    , gla {}
 {}
 
 
 template<typename E4>
 constexpr
 auto Chain<E4>::
-operator=(Chain&& other) -> Chain&
+operator=(Chain&& other) noexcept -> Chain&
 {
     g = std::move(other.g);
     ngs = std::move(other.ngs);
     idw = std::move(other.idw);
     idc = std::move(other.idc);
     c = std::move(other.c);
+    glm = other.glm;
+    gla = other.gla;
 
     return *this;
 }
@@ -575,6 +642,8 @@ operator=(const Chain& other) -> Chain&
     idw = other.idw;
     idc = other.idc;
     c = other.c;
+    glm = {};
+    gla = {};
 
     return *this;
 }
@@ -605,6 +674,7 @@ insert_edge(
     const auto p = &*g.insert(g.begin() + a, std::move(e));
     for (EgId i {a}; i<length(); ++i)
         g[i].indw = i;
+    set_indma(a);
 
     return p;
 }
@@ -621,11 +691,54 @@ remove_edge(const EgId a) -> Edge*
 
     for (EgId i {a}; i<length(); ++i)
         g[i].indw = i;
+    set_indma(a);
 
     return a < length() ? &g[a] : nullptr;
 }
 
 
+// Inserts edges at g[a], g[a+1], ... shifting the original ones forwards.
+template<typename E4>
+void Chain<E4>::
+insert_edges(
+    Edges&& ee,
+    const EgId a
+)
+{
+    for (auto& e: ee)
+        e.w = idw;
+    g.insert(g.begin() + a,
+             std::make_move_iterator(ee.begin()),
+             std::make_move_iterator(ee.end()));
+    for (EgId i {a}; i<length(); ++i)
+        g[i].indw = i;
+    set_indma(a);
+}
+
+
+// Removes edges g[a] ... g[a+n-1], shifting the following ones backwards.
+template<typename E4>
+auto Chain<E4>::
+remove_edges(
+    const EgId a,
+    const EgId n
+) -> Edges
+{
+    ASSERT(a + n <= length(), "Attempting to erase edges beyond chain length.");
+
+    const auto first = g.begin() + a;
+    Edges ee (std::make_move_iterator(first),
+              std::make_move_iterator(first + n));
+    g.erase(first, first + n);
+
+    for (EgId i {a}; i<length(); ++i)
+        g[i].indw = i;
+    set_indma(a);
+
+    return ee;
+}
+
+
 // Appends an edge at the chain head, i.e. at the back of g.
 template<typename E4>
 void Chain<E4>::
@@ -634,6 +747,22 @@ append_edge(Edge&& e)
     e.w = idw;
     e.indw = length();
     g.push_back(std::move(e));
+    set_indma(length() - 1);
+}
+
+
+template<typename E4>
+void Chain<E4>::
+append_reversed(Edges&& ee)
+{
+    const auto a = length();
+    for (auto& e: ee | std::views::reverse) {
+        e.reverse();
+        e.w = idw;
+        e.indw = length();
+        g.push_back(std::move(e));
+    }
+    set_indma(a);
 }
 
 
@@ -646,6 +775,7 @@ reverse_g()
         o.reverse();
         o.indw = a++;
     }
+    set_indma();
 }
 
 
@@ -1167,6 +1297,9 @@ constexpr
 auto Chain<E4>::
 num_vertices() const noexcept -> szt // D = 1, 2, 3, 4
 {
+    if (is_vacant())  // a vacant slot has no vertices
+        return 0;
+
     if constexpr (D == Deg0)  // count boundaries of disconnected cycles
         return is_disconnected_cycle() ? 1 : 0;
 
@@ -1203,6 +1336,15 @@ length() const noexcept -> EgId
 }
 
 
+template<typename E4>
+constexpr
+auto Chain<E4>::
+is_vacant() const noexcept -> bool
+{
+    return g.empty();
+}
+
+
 template<typename E4>
 constexpr
 auto Chain<E4>::
@@ -1226,6 +1368,51 @@ set_g_w(const Id w) noexcept
         o.w = w;
         o.indw = a++;
     }
+    set_indma();
+}
+
+
+template<typename E4>
+constexpr
+void Chain<E4>::
+bind_indma(ChIds& glm, EgIds& gla) noexcept
+{
+    this->glm = &glm;
+    this->gla = &gla;
+}
+
+
+template<typename E4>
+constexpr
+auto Chain<E4>::
+is_bound_to(
+    const ChIds& glm,
+    const EgIds& gla
+) const noexcept -> bool
+{
+    return this->glm == &glm &&
+           this->gla == &gla;
+}
+
+
+// Records edges g[a], g[a+1], ... in the bound edge index maps.
+template<typename E4>
+constexpr
+void Chain<E4>::
+set_indma(const EgId a) noexcept
+{
+    if (!glm || !gla)
+        return;
+
+    for (EgId i {a}; i<length(); ++i) {
+        const auto ind = g[i].ind;
+        if (ind >= glm->size()) {
+            glm->resize(ind + 1);
+            gla->resize(ind + 1);
+        }
+        (*glm)[ind] = g[i].w;
+        (*gla)[ind] = i;
+    }
 }
 
 
@@ -31,6 +31,8 @@ limitations under the License.
 #include <array>
 #include <ostream>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include "../definitions.h"
@@ -53,6 +55,23 @@ struct ChainIndexes
     using SingleChainId =
         std::conditional_t<isSingleChain, ChId, ChIds>;
 
+    /// Index collections a chain may be classified to.
+    enum class List {None, cn11, cn22, cn33, cn44, cn13, cn14, cn34};
+
+    /// Back-pointer from a chain to its entry in the index collections.
+    struct Position {
+        List list {List::None};  ///< Collection holding the chain.
+        szt pos {};              ///< Position of the chain in the collection.
+        EndSlot s {};            ///< Recorded slot for cn13, cn14 and cn34.
+    };
+
+    /// Back-pointers indexed by chain ids: dense for the graph-wide indexes,
+    /// sparse for those of a single component.
+    using Positions =
+        std::conditional_t<isSingleChain,
+                           std::unordered_map<ChId, Position>,
+                           std::vector<Position>>;
+
     /// Index of disconnected linear chain if it is this component or undefined.
     SingleChainId cn11;
 
@@ -74,6 +93,9 @@ struct ChainIndexes
     /// End slots of chains spanned between vertices of degrees 3 and 4.
     std::vector<EndSlot> cn34;
 
+    /// Entries of the chains in the collections above.
+    Positions positions;
+
     constexpr ChainIndexes();
     constexpr explicit ChainIndexes(const ChainIndexes& other) = default;
     constexpr explicit ChainIndexes(ChainIndexes&& other);
@@ -87,22 +109,73 @@ struct ChainIndexes
 
     void append(ChainIndexes&& other);
 
+    /**
+     * @brief Determines the collection chain \p m belongs to.
+     * @param m Chain to classify.
+     * @return Position with the collection and, for cn13, cn14 and cn34, the
+     * slot to be recorded; the position inside the collection is not set.
+     */
+    template<typename Chain>
+    static auto classify(const Chain& m) -> Position;
+
     template<typename Chain>
     void include(const Chain& m);
 
     template<typename Chain>
     void remove(const Chain& m);
 
+    /**
+     * @brief Removes the entry of chain \p w irrespective of its current state.
+     * @details Uses the back-pointer of \p w and moves the last entry of the
+     * collection into the vacated position.
+     * @param w Chain id.
+     */
+    void remove(ChId w);
+
+    /**
+     * @brief Transfers the entry of chain \p f to chain \p t.
+     * @param f Initial chain id.
+     * @param t Final chain id.
+     */
+    void rename(ChId f, ChId t);
+
+    /// Entry of chain \p w, or List::None if the chain is not indexed.
+    auto position(ChId w) const noexcept -> Position;
+
+    /// Checks that the back-pointers agree with the collections.
+    auto positions_are_consistent() const -> bool;
+
     template<typename Chains>
     void populate(const Chains& cn);
 
     template<typename Chains>
     void populate(const Chains& cn, const ChIds& ww);
 
+    /**
+     * @brief Reclassifies chains \p ww leaving other entries intact.
+     * @details Entries of chains no longer present in \p cn are dropped:
+     * for the indexes of a single component, only those of chains in \p ww.
+     * A chain in \p ww is moved to another collection only if the number of
+     * neighbours at one of its ends has changed.
+     * @param cn Chain container.
+     * @param ww Ids of the chains to reclassify.
+     */
+    template<typename Chains>
+    void update(const Chains& cn, const ChIds& ww);
+
     void report(std::ostream& ofs) const;
 
     template<typename... Args>
     void print(Args&&... args) const;
+
+private:
+
+    void set_position(ChId w, const Position& p);
+    void drop_position(ChId w);
+    void add(ChId w, Position p);
+
+    static constexpr auto chain_of(ChId w) noexcept -> ChId { return w; }
+    static constexpr auto chain_of(const EndSlot& s) noexcept -> ChId { return s.w; }
 };
 
 // IMPLEMENTATION ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -148,6 +221,7 @@ ChainIndexes(ChainIndexes&& other)
     , cn13 {std::move(other.cn13)}
     , cn14 {std::move(other.cn14)}
     , cn34 {std::move(other.cn34)}
+    , positions {std::move(other.positions)}
 {}
 
 /*
@@ -182,6 +256,7 @@ operator=(ChainIndexes&& other) -> ChainIndexes&
     cn13 = std::move(other.cn13);
     cn14 = std::move(other.cn14);
     cn34 = std::move(other.cn34);
+    positions = std::move(other.positions);
 
     return *this;
 }
@@ -224,6 +299,7 @@ clear() noexcept
     cn13.clear();
     cn14.clear();
     cn34.clear();
+    positions.clear();
 }
 
 
@@ -238,6 +314,35 @@ append(ChainIndexes&& other)
         from.erase(from.begin(), from.end());
     };
 
+    // Positions of the other's entries are shifted by the current sizes:
+    const auto offset = [&](const List l) -> szt
+    {
+        switch (l) {
+            case List::cn11: if constexpr (!isSingleChain) return cn11.size();
+                             else return 0;
+            case List::cn22: if constexpr (!isSingleChain) return cn22.size();
+                             else return 0;
+            case List::cn33: return cn33.size();
+            case List::cn44: return cn44.size();
+            case List::cn13: return cn13.size();
+            case List::cn14: return cn14.size();
+            case List::cn34: return cn34.size();
+            default: return 0;
+        }
+    };
+    if constexpr (isSingleChain)
+        for (auto [w, p]: other.positions) {
+            p.pos += offset(p.list);
+            set_position(w, p);
+        }
+    else
+        for (ChId w {}; w<other.positions.size(); ++w)
+            if (auto p = other.positions[w]; p.list != List::None) {
+                p.pos += offset(p.list);
+                set_position(w, p);
+            }
+    other.positions.clear();
+
     if constexpr (isSingleChain) {
         ASSERT(!is_defined(cn11) || !is_defined(other.cn11), "incompatibe cn11");
         if (is_defined(other.cn11))
@@ -291,9 +396,42 @@ populate(const Chains& cn,
 
 template<bool isSingleChain,
          typename ES>
-template<typename Chain>
+template<typename Chains>
 void ChainIndexes<isSingleChain, ES>::
-include(const Chain& m)
+update(const Chains& cn,
+       const ChIds& ww)
+{
+    // Drop chains no longer present in the graph. The sparse entries are
+    // looked up by key, as the ids of the removed chains are among ww:
+    if constexpr (isSingleChain) {
+        for (const auto w: ww)
+            if (w >= cn.size())
+                remove(w);
+    }
+    else
+        while (positions.size() > cn.size()) {
+            remove(static_cast<ChId>(positions.size() - 1));
+            positions.pop_back();
+        }
+
+    for (const auto w: ww) {
+        if (w >= cn.size())
+            continue;
+        const auto p = classify(cn[w]);
+        const auto q = position(w);
+        if (p.list == q.list && p.s == q.s)
+            continue;  // end degrees unchanged
+        remove(w);
+        add(w, p);
+    }
+}
+
+
+template<bool isSingleChain,
+         typename ES>
+template<typename Chain>
+auto ChainIndexes<isSingleChain, ES>::
+classify(const Chain& m) -> Position
 {
     auto assignment_impossble = [&](const ChId j)
     {
@@ -306,45 +444,44 @@ include(const Chain& m)
     [[maybe_unused]] const auto nA = m.ngs[Ends::A].num();
     [[maybe_unused]] const auto nB = m.ngs[Ends::B].num();
 
-    if (m.has_one_free_end()) {
+    if (m.is_vacant())
+        return {};  // a vacant slot is not indexed
+
+    else if (m.has_one_free_end()) {
         const auto e = m.the_only_free_end();
         const auto oe = Ends::opp(e);
 
         if (m.ngs[oe].num() == 2)
-            cn13.push_back(EndSlot{m.idw, e});
+            return {List::cn13, {}, EndSlot{m.idw, e}};
 
         else if (m.ngs[oe].num() == 3)
-            cn14.push_back(EndSlot{m.idw, e});
+            return {List::cn14, {}, EndSlot{m.idw, e}};
 
         else
             assignment_impossble(m.idw);
     }
-    else if (nA == 0 && nB == 0) {
-        if constexpr (isSingleChain)
-            cn11 = m.idw;  // having both ends free, it is a separate chain
-        else
-            cn11.push_back(m.idw);
-    }
-    else if (m.is_disconnected_cycle()) {
-        if constexpr (isSingleChain)
-            cn22 = m.idw;
-        else
-            cn22.push_back(m.idw);  // it is a separate chain as it has 2 free ends
-    }
+    else if (nA == 0 && nB == 0)
+        return {List::cn11};  // having both ends free, it is a separate chain
+
+    else if (m.is_disconnected_cycle())
+        return {List::cn22};  // it is a separate chain as it has 2 free ends
+
     else if (nA == 2 && nB == 2)
-        cn33.push_back(m.idw);
+        return {List::cn33};
 
     else if (nA == 2 && nB == 3)
-        cn34.push_back(EndSlot{m.idw, Ends::A});
+        return {List::cn34, {}, EndSlot{m.idw, Ends::A}};
 
     else if (nA == 3 && nB == 2)
-        cn34.push_back(EndSlot{m.idw, Ends::B});
+        return {List::cn34, {}, EndSlot{m.idw, Ends::B}};
 
     else if (nA == 3 && nB == 3)
-        cn44.push_back(m.idw);
+        return {List::cn44};
 
     else
         assignment_impossble(m.idw);
+
+    return {};
 }
 
 
@@ -352,58 +489,231 @@ template<bool isSingleChain,
          typename ES>
 template<typename Chain>
 void ChainIndexes<isSingleChain, ES>::
-remove(const Chain& m)
+include(const Chain& m)
+{
+    add(m.idw, classify(m));
+}
+
+
+template<bool isSingleChain,
+         typename ES>
+void ChainIndexes<isSingleChain, ES>::
+add(const ChId w, Position p)
 {
-    auto removal_impossble = [&](const ChId j)
+    const auto push = [&](auto& v, auto&& x)
     {
-        m.print("removal impossble ");
+        p.pos = v.size();
+        v.push_back(std::move(x));
+    };
 
-        abort("failed classification for chain ", j);
+    // A single-chain id is overwritten by the chain included last:
+    const auto assign = [&](ChId& v)
+    {
+        if (is_defined(v))
+            drop_position(v);
+        v = w;
+    };
+
+    switch (p.list) {
+        case List::cn11:
+            if constexpr (isSingleChain) assign(cn11);
+            else                         push(cn11, w);
+            break;
+        case List::cn22:
+            if constexpr (isSingleChain) assign(cn22);
+            else                         push(cn22, w);
+            break;
+        case List::cn33: push(cn33, w); break;
+        case List::cn44: push(cn44, w); break;
+        case List::cn13: push(cn13, p.s); break;
+        case List::cn14: push(cn14, p.s); break;
+        case List::cn34: push(cn34, p.s); break;
+        default: return;
+    }
+
+    set_position(w, p);
+}
+
+
+template<bool isSingleChain,
+         typename ES>
+template<typename Chain>
+void ChainIndexes<isSingleChain, ES>::
+remove(const Chain& m)
+{
+    remove(m.idw);
+}
 
+
+// Removes the entry of chain w moving the last entry into its place.
+template<bool isSingleChain,
+         typename ES>
+void ChainIndexes<isSingleChain, ES>::
+remove(const ChId w)
+{
+    const auto p = position(w);
+
+    const auto swap_pop = [&](auto& v)
+    {
+        ASSERT(p.pos < v.size() && chain_of(v[p.pos]) == w,
+               "inconsistent back-pointer of chain ", w);
+        if (p.pos + 1 != v.size()) {
+            v[p.pos] = std::move(v.back());
+            auto q = position(chain_of(v[p.pos]));
+            q.pos = p.pos;
+            set_position(chain_of(v[p.pos]), q);
+        }
+        v.pop_back();
     };
 
-    [[maybe_unused]] const auto nA = m.ngs[Ends::A].num();
-    [[maybe_unused]] const auto nB = m.ngs[Ends::B].num();
+    switch (p.list) {
+        case List::cn11:
+            if constexpr (isSingleChain) cn11 = undefined<ChId>;
+            else                         swap_pop(cn11);
+            break;
+        case List::cn22:
+            if constexpr (isSingleChain) cn22 = undefined<ChId>;
+            else                         swap_pop(cn22);
+            break;
+        case List::cn33: swap_pop(cn33); break;
+        case List::cn44: swap_pop(cn44); break;
+        case List::cn13: swap_pop(cn13); break;
+        case List::cn14: swap_pop(cn14); break;
+        case List::cn34: swap_pop(cn34); break;
+        default: return;
+    }
 
-    if (m.has_one_free_end()) {
-        const auto e = m.the_only_free_end();
-        const auto oe = Ends::opp(e);
+    drop_position(w);
+}
 
-        if (m.ngs[oe].num() == 2)
-            std::erase(cn13, EndSlot{m.idw, e});
 
-        else if (m.ngs[oe].num() == 3)
-            std::erase(cn14, EndSlot{m.idw, e});
+template<bool isSingleChain,
+         typename ES>
+void ChainIndexes<isSingleChain, ES>::
+rename(const ChId f, const ChId t)
+{
+    remove(t);
+
+    auto p = position(f);
+    if (p.list == List::None)
+        return;
 
+    const auto relabel = [&](auto& v)
+    {
+        if constexpr (std::is_same_v<std::remove_cvref_t<decltype(v[p.pos])>,
+                                     EndSlot>)
+            v[p.pos].w = t;
         else
-            removal_impossble(m.idw);
+            v[p.pos] = t;
+    };
+
+    switch (p.list) {
+        case List::cn11:
+            if constexpr (isSingleChain) cn11 = t;
+            else                         relabel(cn11);
+            break;
+        case List::cn22:
+            if constexpr (isSingleChain) cn22 = t;
+            else                         relabel(cn22);
+            break;
+        case List::cn33: relabel(cn33); break;
+        case List::cn44: relabel(cn44); break;
+        case List::cn13: relabel(cn13); break;
+        case List::cn14: relabel(cn14); break;
+        case List::cn34: relabel(cn34); break;
+        default: break;
     }
-    else if (nA == 0 && nB == 0) {
-        if constexpr (isSingleChain)
-            cn11 = undefined<ChId>;
-        else
-            std::erase(cn11, m.idw);
+    if (p.s.is_defined())
+        p.s.w = t;
+
+    drop_position(f);
+    set_position(t, p);
+}
+
+
+template<bool isSingleChain,
+         typename ES>
+auto ChainIndexes<isSingleChain, ES>::
+position(const ChId w) const noexcept -> Position
+{
+    if constexpr (isSingleChain) {
+        const auto i = positions.find(w);
+        return i != positions.end() ? i->second : Position {};
     }
-    else if (m.is_disconnected_cycle()) {
-        if constexpr (isSingleChain)
-            cn22 = undefined<ChId>;
-        else
-            std::erase(cn22, m.idw);
+    else
+        return w < positions.size() ? positions[w] : Position {};
+}
+
+
+template<bool isSingleChain,
+         typename ES>
+void ChainIndexes<isSingleChain, ES>::
+set_position(const ChId w, const Position& p)
+{
+    if constexpr (isSingleChain)
+        positions[w] = p;
+    else {
+        if (w >= positions.size())
+            positions.resize(w + 1);
+        positions[w] = p;
     }
-    else if (nA == 2 && nB == 2)
-        std::erase(cn33, m.idw);
+}
 
-    else if (nA == 2 && nB == 3)
-        std::erase(cn34, EndSlot{m.idw, Ends::A});
 
-    else if (nA == 3 && nB == 2)
-        std::erase(cn34, EndSlot{m.idw, Ends::B});
+template<bool isSingleChain,
+         typename ES>
+void ChainIndexes<isSingleChain, ES>::
+drop_position(const ChId w)
+{
+    if constexpr (isSingleChain)
+        positions.erase(w);
+    else if (w < positions.size())
+        positions[w] = Position {};
+}
 
-    else if (nA == 3 && nB == 3)
-        std::erase(cn44, m.idw);
 
+template<bool isSingleChain,
+         typename ES>
+auto ChainIndexes<isSingleChain, ES>::
+positions_are_consistent() const -> bool
+{
+    szt num {};
+
+    const auto check = [&](const auto& v, const List l)
+    {
+        for (szt i {}; i<v.size(); ++i) {
+            const auto p = position(chain_of(v[i]));
+            if (p.list != l || p.pos != i)
+                return false;
+        }
+        num += v.size();
+        return true;
+    };
+
+    const auto check_single = [&](const ChId w, const List l)
+    {
+        if (!is_defined(w))
+            return true;
+        ++num;
+        return position(w).list == l;
+    };
+
+    bool res {};
+    if constexpr (isSingleChain)
+        res = check_single(cn11, List::cn11) && check_single(cn22, List::cn22);
+    else
+        res = check(cn11, List::cn11) && check(cn22, List::cn22);
+
+    res = res && check(cn33, List::cn33) && check(cn44, List::cn44) &&
+                 check(cn13, List::cn13) && check(cn14, List::cn14) &&
+                 check(cn34, List::cn34);
+
+    if constexpr (isSingleChain)
+        return res && num == positions.size();
     else
-        removal_impossble(m.idw);
+        return res && num == static_cast<szt>(
+            std::ranges::count_if(positions, [](const auto& p)
+                                  { return p.list != List::None; }));
 }
 
 
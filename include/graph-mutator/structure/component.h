@@ -27,12 +27,16 @@ limitations under the License.
 #ifndef GRAPH_MUTATOR_STRUCTURE_COMPONENT_H
 #define GRAPH_MUTATOR_STRUCTURE_COMPONENT_H
 
-#include <algorithm>  // remove, ranges::sort
+#include <algorithm>  // remove, ranges::sort, unique
 #include <array>
 #include <deque>
+#include <memory>     // unique_ptr
 #include <ranges>
 #include <set>
+#include <span>
 #include <string>
+#include <unordered_map>
+#include <utility>    // as_const, forward, pair
 #include <vector>
 
 #include "../definitions.h"
@@ -41,6 +45,7 @@ limitations under the License.
 #include "chain_collection.h"
 #include "chain_indexes.h"
 #include "ends.h"
+#include "paths/workspace.h"
 #include "slot.h"
 #include "vertices/collections.h"
 #include "vertices/all.h"
@@ -118,6 +123,53 @@ struct Gl {
 };
 
 
+// /////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Owner of data allocated on first use.
+ * @details The data are derived from the owning object and may refer to it:
+ * copies and moves of the owner start without them, and assignment to the
+ * owner drops them, so that they are rebuilt on the next access.
+ * @tparam T Type of the data.
+ */
+template<typename T>
+class Deferred {
+
+public:
+
+    Deferred() = default;
+    Deferred(const Deferred&) noexcept {}
+    Deferred(Deferred&&) noexcept {}
+    auto operator=(const Deferred&) noexcept -> Deferred& { reset(); return *this; }
+    auto operator=(Deferred&&) noexcept -> Deferred& { reset(); return *this; }
+    ~Deferred() = default;
+
+    constexpr explicit operator bool() const noexcept { return p != nullptr; }
+
+    /// Returns the data, constructing them from \p args if absent.
+    template<typename... Args>
+    auto get(Args&&... args) -> T&;
+
+    void reset() noexcept { p.reset(); }
+
+private:
+
+    std::unique_ptr<T> p;
+};
+
+
+template<typename T>
+template<typename... Args>
+auto Deferred<T>::
+get(Args&&... args) -> T&
+{
+    if (!p)
+        p = std::make_unique<T>(std::forward<Args>(args)...);
+
+    return *p;
+}
+
+
 // /////////////////////////////////////////////////////////////////////////////
 
 /**
@@ -141,20 +193,70 @@ struct DisconnectedUnit {
 
     std::vector<Gl> gl;       ///< Edge descriptors.
 
+    /// Positions in gl of the edges keyed by their graph-wide indexes.
+    std::unordered_map<EgId, EgId> indcs;
+
     // cpcn
-    ChIds ww;                 ///< Chain indices.
+    ChIds ww;                 ///< Chain indices ordered by Chain::idc.
 
-    // cpagl
-    vec2<EgId> ajlg;           ///< Edge adjacency_list.
-    vec2<vertices::Id> ajlev;  ///< Vertex adjacency_list for end vertices.
+    ChainIndexes<true, EndSlot> chis;  ///< Chain indexes according to end degrees.
 
-    vec2<ChId> ajlw;           ///< Chain adjacency_list.
-    vec2<ChId> ajlwA;          ///< Chain adjacency_list in direction backwards.
-    vec2<ChId> ajlwB;          ///< Chain adjacency_list in direction forwards.
+    /**
+     * @brief Classification of the component edge weights.
+     * @details Is cached for the searches over edges, which choose their
+     * method by it: see weight_class().
+     */
+    struct WeightClass {
+        enum Kind { unknown, equal, smallIntegral, general };
 
-    Vertices vertices;
+        Kind kind {unknown};
+        EdgeWeight maxWeight {};  ///< Maximal edge weight.
+    };
 
-    ChainIndexes<true, EndSlot> chis;  ///< Chain indexes according to end degrees.
+    /**
+     * @brief Data derived from the component structure.
+     * @details Most of the memory of a component lies here, while many
+     * components, such as the single chains of a nucleation phase, never
+     * need these data. They are therefore allocated on first use only:
+     * see details().
+     */
+    struct Details {
+
+        // cpagl
+        vec2<EgId> ajlg;           ///< Edge adjacency_list.
+        vec2<vertices::Id> ajlev;  ///< Vertex adjacency_list for end vertices.
+
+        vec2<ChId> ajlw;           ///< Chain adjacency_list.
+        vec2<ChId> ajlwA;          ///< Chain adjacency_list in direction backwards.
+        vec2<ChId> ajlwB;          ///< Chain adjacency_list in direction forwards.
+
+        Vertices vertices;
+
+        bool ajlgOutdated {true};  ///< ajlg is to be rebuilt entirely.
+        bool ajlwOutdated {true};  ///< ajlwA and ajlwB are to be rebuilt.
+        ChIds ajlgPending;         ///< Chains whose ajlg rows are outdated.
+
+        WeightClass weights;       ///< Classification of the edge weights.
+
+        explicit Details(const DisconnectedUnit& c)
+            : vertices {c}
+        {}
+    };
+
+    /**
+     * @brief Buffers of the searches over the component chains.
+     * @details Are allocated by the first search apart from Details, so that
+     * searching does not build the derived data.
+     */
+    struct Search {
+        /// IDs of chains visited during a search, keyed by Chain::idc or,
+        /// for searches over the whole graph, by the chain id.
+        paths::StampedArray<ChId> visited {undefined<ChId>};
+        ChIds reached;  ///< Chains in the order of visiting.
+
+        /// Slots being expanded by dfs_ and their next neig indexes.
+        std::vector<std::pair<EndSlot, szt>> trail;
+    };
 
     constexpr explicit DisconnectedUnit(
         CmpId ind,
@@ -179,11 +281,29 @@ struct DisconnectedUnit {
         Chains& cn
     );
 
+    /**
+     * @brief Copy of component \p other formed by chains \p cn.
+     * @details Is used by copies of a graph, which hold copies of the chains.
+     */
+    constexpr explicit DisconnectedUnit(
+        const DisconnectedUnit& other,
+        Chains& cn
+    );
+
+    /**
+     * @brief Component \p other moved to chains \p cn.
+     * @details Is used by moves of a graph, which move the chains.
+     */
+    constexpr explicit DisconnectedUnit(
+        DisconnectedUnit&& other,
+        Chains& cn
+    ) noexcept;
+
     DisconnectedUnit() = delete;
     constexpr explicit DisconnectedUnit(const DisconnectedUnit& other) = default;
-    constexpr explicit DisconnectedUnit(DisconnectedUnit&& other);
+    constexpr explicit DisconnectedUnit(DisconnectedUnit&& other) noexcept;
     constexpr auto operator=(const DisconnectedUnit& other) -> DisconnectedUnit& = default;
-    constexpr auto operator=(DisconnectedUnit&& other) -> DisconnectedUnit&;
+    constexpr auto operator=(DisconnectedUnit&& other) noexcept -> DisconnectedUnit&;
     ~DisconnectedUnit() = default;
 
     constexpr auto operator==(const DisconnectedUnit& other) -> bool;
@@ -194,6 +314,14 @@ struct DisconnectedUnit {
     void set_gl() noexcept;
     void set_chis() noexcept;
 
+    /**
+     * @brief Reclassifies in chis the chains \p ww and those connected to them.
+     * @details Only chains of this component whose end degrees have changed
+     * are moved between the index collections.
+     * @param ww Indexes of the modified chains.
+     */
+    void update_chis(ChIds ww) noexcept;
+
     void rename_chain(ChId f, ChId t) noexcept;
 
     void clear();
@@ -232,6 +360,14 @@ struct DisconnectedUnit {
     auto find_chains(const EndSlot& source) noexcept -> ChIds;
     auto find_chains(ChId seed) noexcept -> ChIds;
 
+    /**
+     * @brief Chains found by find_chains(source), in the order of visiting.
+     * @note The span refers to an internal buffer and is invalidated by the
+     * next search over this component.
+     */
+    auto find_chains_view(const EndSlot& source) noexcept
+        -> std::span<const ChId>;
+
     auto edge(EgId indc) const noexcept -> const Edge&;
     auto chain(ChId w) const noexcept -> const Chain&;
     auto chid(ChId idc) const noexcept -> const ChId;
@@ -246,6 +382,17 @@ struct DisconnectedUnit {
     void shift_last_edge(const EndSlot& f,
                          const EndSlot& t);
 
+    /**
+     * @brief shifts \p n edges from f.e end of f.w to t.e end of t.w
+     * @details The edges keep their order across the link between the
+     * chains, as if shifted one by one by shift_last_edge(). Component-wide
+     * edge indexes are left to be refreshed by set_gl() once all the shifts
+     * are done.
+     */
+    void shift_end_edges(const EndSlot& f,
+                         const EndSlot& t,
+                         EgId n);
+
     /**
      * @brief Initializes adjacency list of edges of this component.
      */
@@ -262,6 +409,55 @@ struct DisconnectedUnit {
     template<Orientation dir>
     auto adjacency_list_chains() const noexcept -> vec2<ChId>;
 
+    /**
+     * @brief Edge adjacency list of this component.
+     * @details The list is kept in Details::ajlg and recomputed on access
+     * only if the component has changed since: rows of the edges of chains
+     * marked by invalidate_adjacency(ChId) are patched in place, while
+     * structural changes of the component make it rebuilt entirely.
+     * Repeated entries following one another in a row are dropped.
+     * @note Not thread-safe: the refresh writes to the mutable Details.
+     * Before searching a component from several threads, bring the cache
+     * up to date from a single one, e.g. by Graph::update_adjacency();
+     * the concurrent calls then only read it.
+     */
+    auto edge_adjacency() const -> const vec2<EgId>&;
+
+    /**
+     * @brief Chain adjacency list of this component in direction \p dir.
+     * @details The list is kept in Details::ajlwA or Details::ajlwB and
+     * rebuilt on access after any change of the component.
+     * @note Not thread-safe, see edge_adjacency().
+     */
+    template<Orientation dir>
+    auto chain_adjacency() const -> const vec2<ChId>&;
+
+    /// Marks the cached adjacency lists as outdated entirely.
+    void invalidate_adjacency() noexcept;
+
+    /**
+     * @brief Marks the cached adjacency of chain \p w as outdated.
+     * @details Is called for the chains whose edges or neighbours have
+     * changed; the adjacency rows of their edges and of the end edges of
+     * their neighbours are recomputed on the next access.
+     */
+    void invalidate_adjacency(ChId w) noexcept;
+
+    /**
+     * @brief Classification of the edge weights of this component.
+     * @details Is kept in Details::weights and obtained from \p classify
+     * only if the component has changed since, together with the
+     * adjacency lists. Edge weights altered in place, rather than by the
+     * transformations, require invalidate_weights().
+     * @note Not thread-safe, see edge_adjacency().
+     * @param classify Callable returning the WeightClass of the edges.
+     */
+    template<typename F>
+    auto weight_class(F&& classify) const -> const WeightClass&;
+
+    /// Marks the cached classification of the edge weights as outdated.
+    void invalidate_weights() noexcept;
+
     auto ww_is_sorted() const noexcept -> bool;
 
     /**
@@ -300,11 +496,20 @@ struct DisconnectedUnit {
     template<bool with_top=true>
     void print_ww() const noexcept;
 
-    auto get_visited() const noexcept -> const std::vector<ChId>&
+    auto get_visited() const -> const paths::StampedArray<ChId>&
     {
-        return visited;
+        return search().visited;
     }
 
+    /// Derived data of this component; allocated on the first call.
+    auto details() const -> Details&;
+
+    /// Search buffers of this component; allocated on the first call.
+    auto search() const -> Search&;
+
+    /// Checks if the derived data are allocated.
+    constexpr auto has_details() const noexcept -> bool;
+
     /**
      * @brief Checks that \p cond is satisfied, else terminates program.
      * @details Prints out the component using \p tag before terminating the
@@ -325,7 +530,15 @@ private:
 
     Chains& cn;  ///< Reference to the parent chains container.
 
-    ChIds visited;  ///< Auxiliary: IDs of chains visited during a search.
+    mutable Deferred<Details> dd;  ///< Derived data: see details().
+    mutable Deferred<Search> sb;   ///< Search buffers: see search().
+
+    /// Removes chain \p w from ww keeping ww ordered by Chain::idc.
+    void remove_from_ww(ChId w) noexcept;
+
+    /// Appends to \p a the edges adjacent to edge \p k of chain \p m.
+    void adjacent_edges(const Chain& m, EgId k,
+                        std::vector<EgId>& a) const noexcept;
 
     template<bool knownSize>
     void reset_search() noexcept;
@@ -333,7 +546,8 @@ private:
     /**
      * @brief Depth-first search of the graph graph.
      * @note Assumes that initialization of the auxiliary variables is
-     * already done.
+     * already done. Uses an explicit stack, so that its depth is not
+     * limited by the size of the call stack.
      * @tparam knownSize if true enumerates over this cluster,
      * otherwise - over the whole graph
      * @param source Initial slot.
@@ -346,12 +560,13 @@ private:
         const EndSlot& target
     ) -> bool;
 
+    /// Breadth-first search from the slots in \p q until \p target.w.
     template<bool knownSize>
     auto bfs_(
         std::deque<EndSlot>& q,     // by reference
         const EndSlot& target,
         const EndSlot& source = EndSlot {}
-    ) const -> bool;
+    ) -> bool;
 
 };
 
@@ -366,7 +581,6 @@ DisconnectedUnit(
     Chains& cn
 )
     : ind {ind}
-    , vertices {*this}
     , cn {cn}
 {}
 
@@ -416,14 +630,43 @@ DisconnectedUnit(
 template<typename Ch>
 constexpr
 DisconnectedUnit<Ch>::
-DisconnectedUnit(DisconnectedUnit&& other)
+DisconnectedUnit(
+    const DisconnectedUnit& other,
+    Chains& cn
+)
+    : ind {other.ind}
+    , gl {other.gl}
+    , indcs {other.indcs}
+    , ww {other.ww}
+    , chis {other.chis}
+    , cn {cn}
+{}
+
+
+template<typename Ch>
+constexpr
+DisconnectedUnit<Ch>::
+DisconnectedUnit(
+    DisconnectedUnit&& other,
+    Chains& cn
+) noexcept
+    : ind {other.ind}
+    , gl {std::move(other.gl)}
+    , indcs {std::move(other.indcs)}
+    , ww {std::move(other.ww)}
+    , chis {std::move(other.chis)}
+    , cn {cn}
+{}
+
+
+template<typename Ch>
+constexpr
+DisconnectedUnit<Ch>::
+DisconnectedUnit(DisconnectedUnit&& other) noexcept
     : ind {other.ind}
     , gl {std::move(other.gl)}
+    , indcs {std::move(other.indcs)}
     , ww {std::move(other.ww)}
-    , ajlg {std::move(other.ajlg)}
-    , ajlw {std::move(other.ajlw)}
-    , ajlwA {std::move(other.ajlwA)}
-    , ajlwB {std::move(other.ajlwB)}
     , chis {std::move(other.chis)}
     , cn {other.cn}
 {}
@@ -432,17 +675,16 @@ DisconnectedUnit(DisconnectedUnit&& other)
 template<typename Ch>
 constexpr
 auto DisconnectedUnit<Ch>::
-operator=(DisconnectedUnit&& other) -> DisconnectedUnit&
+operator=(DisconnectedUnit&& other) noexcept -> DisconnectedUnit&
 {
     ind = other.ind;
     gl = std::move(other.gl);
+    indcs = std::move(other.indcs);
     ww = std::move(other.ww);
-    ajlg = std::move(other.ajlg);
-    ajlw = std::move(other.ajlw);
-    ajlwA = std::move(other.ajlwA);
-    ajlwB = std::move(other.ajlwB);
     chis = std::move(other.chis);
     cn = other.cn;
+    dd.reset();
+    sb.reset();
 
     return *this;
 }
@@ -485,12 +727,11 @@ void DisconnectedUnit<Ch>::
 clear()
 {
     gl.clear();
+    indcs.clear();
     ww.clear();
-    ajlg.clear();
-    ajlw.clear();
-    ajlwA.clear();
-    ajlwB.clear();
     chis.clear();
+    dd.reset();
+    sb.reset();
 }
 
 
@@ -557,6 +798,8 @@ set_edges() noexcept
     EgId indc {};
     for (const auto w: ww)
         indc = cn[w].set_g_cmp(ind, indc);
+
+    invalidate_adjacency();
 }
 
 
@@ -567,7 +810,7 @@ rename_chain(const ChId f, const ChId t) noexcept
     std::replace(ww.begin(), ww.end(), f, t);
     std::for_each(gl.begin(), gl.end(),
                   [&](components::Gl& g) { if (g.w == f) g.w = t; });
-    chis.populate(cn, ww);
+    chis.rename(f, t);
 }
 
 
@@ -576,7 +819,12 @@ constexpr
 auto DisconnectedUnit<Ch>::
 contains_chain(const ChId w) const noexcept -> bool
 {
-    return std::find(ww.begin(), ww.end(), w) != ww.end();
+    if (w >= cn.size())
+        return false;
+
+    const auto idc = cn[w].idc;
+
+    return idc < ww.size() && ww[idc] == w;
 }
 
 
@@ -594,8 +842,7 @@ constexpr
 auto DisconnectedUnit<Ch>::
 contains_edge(const EgId ei) const noexcept -> bool
 {
-    return std::find_if(gl.begin(), gl.end(),
-                        [&](const Gl& i) { return i.i == ei; }) != gl.end();
+    return indcs.contains(ei);
 }
 
 
@@ -612,7 +859,8 @@ template<typename Ch>
 void DisconnectedUnit<Ch>::
 append(DisconnectedUnit&& other)
 {
-    auto indc = num_edges();
+    const auto indc0 = num_edges();
+    auto indc = indc0;
     auto idc = num_chains();
 
     ASSERT(other.ind != ind, "appending identical compinent");
@@ -623,7 +871,12 @@ append(DisconnectedUnit&& other)
     std::move(other.gl.begin(), other.gl.end(), std::back_inserter(gl));
     std::move(other.ww.begin(), other.ww.end(), std::back_inserter(ww));
 
+    for (auto i = indc0; i<num_edges(); ++i)
+        indcs[gl[i].i] = i;
+
     chis.append(std::move(other.chis));
+
+    invalidate_adjacency();
 }
 
 
@@ -631,7 +884,8 @@ template<typename Ch>
 void DisconnectedUnit<Ch>::
 append(DisconnectedUnit& other)
 {
-    auto indc = num_edges();
+    const auto indc0 = num_edges();
+    auto indc = indc0;
     auto idc = num_chains();
 
     ASSERT(other.ind != ind, "appending identical compinent");
@@ -642,7 +896,12 @@ append(DisconnectedUnit& other)
     std::move(other.gl.begin(), other.gl.end(), std::back_inserter(gl));
     std::move(other.ww.begin(), other.ww.end(), std::back_inserter(ww));
 
+    for (auto i = indc0; i<num_edges(); ++i)
+        indcs[gl[i].i] = i;
+
     chis.append(std::move(other.chis));
+
+    invalidate_adjacency();
 }
 
 
@@ -676,13 +935,17 @@ append(Chain& m)
 
     m.set_cmpt(ind, idc, indc);
 
-    for (const auto& g: m.g)
+    for (const auto& g: m.g) {
+        indcs[g.ind] = num_edges();
         gl.emplace_back(g.w, g.indw, g.ind);
+    }
 
     ww.push_back(m.idw);
 
     chis.include(m);
 
+    invalidate_adjacency();
+
 //    ASSERT(ww_is_sorted(), "ww is out of order");
 }
 
@@ -734,9 +997,13 @@ remove(const Edge& eg)
         auto& q = cn[b.w].g[b.a];
         q.indc = eg.indc;
         gl[eg.indc] = {q.w, q.indw, q.ind};
+        indcs[q.ind] = q.indc;
     }
 
     gl.pop_back();
+    indcs.erase(eg.ind);
+
+    invalidate_adjacency();
 }
 
 
@@ -758,20 +1025,11 @@ remove(const Chain& m)
     for (const auto& eg: g)
         remove(eg);
 
-    if (const auto last = num_chains() - 1;
-        m.idc < last)
-        for (const auto w: ww)
-            if (cn[w].idc == last)
-                cn[w].idc = m.idc;
-
-    std::erase(ww, m.idw);
+    remove_from_ww(m.idw);
 
-    if (m.is_disconnected_cycle())
-        chis.populate(cn, ww);
-    else
-        chis.remove(m);
+    chis.remove(m.idw);
 
-//    ASSERT(ww_is_sorted(), "ww is out of order");
+    invalidate_adjacency();
 }
 
 
@@ -794,21 +1052,12 @@ remove(const Chains& mm)
 
     for (const auto& m: mm) {
 
-        if (const auto last = num_chains() - 1;
-            m.idc < last)
-            for (const auto w: ww)
-                if (cn[w].idc == last)
-                    cn[w].idc = m.idc;
+        remove_from_ww(m.idw);
 
-        std::erase(ww, m.idw);
-
-        if (m.is_disconnected_cycle())
-            chis.populate(cn, ww);
-        else
-            chis.remove(m);
+        chis.remove(m.idw);
     }
 
-//    ASSERT(ww_is_sorted(), "ww is out of order");
+    invalidate_adjacency();
 }
 
 
@@ -856,12 +1105,16 @@ set_gl() noexcept
     for (const auto w: ww)
         numEdges += cn[w].length();
     gl.resize(numEdges);
+    indcs.clear();
     for (const auto w: ww)
         for (const auto& g: cn[w].g) {
             ASSERT(g.indc < numEdges, "In component ", ind,
                    " g.indc ", g.indc, " >= numEdges ", numEdges);
             gl[g.indc] = {g.w, g.indw, g.ind};
+            indcs[g.ind] = g.indc;
         }
+
+    invalidate_adjacency();
 }
 
 
@@ -874,11 +1127,31 @@ set_chis() noexcept
 }
 
 
+template<typename Ch>
+void DisconnectedUnit<Ch>::
+update_chis(ChIds vv) noexcept
+{
+    for (szt i {}, n {vv.size()}; i<n; ++i)
+        if (const auto w = vv[i]; w < cn.size())
+            for (const auto e: Ends::Ids)
+                for (const auto& s: cn[w].ngs[e]())
+                    vv.push_back(s.w);
+
+    std::ranges::sort(vv);
+    const auto [first, last] = std::ranges::unique(vv);
+    vv.erase(first, last);
+    std::erase_if(vv, [&](const ChId w) { return w < cn.size() && cn[w].c != ind; });
+
+    chis.update(cn, vv);
+}
+
+
 template<typename Ch>
 void DisconnectedUnit<Ch>::
 make_indma() noexcept
 {
     gl.clear();
+    indcs.clear();
     ww.clear();
 
     for (const auto& m: cn)
@@ -888,9 +1161,14 @@ make_indma() noexcept
             for (const auto& g: m.g) {
                 ASSERT(i++ == g.indc,
                        "i =", i, " != g.indc = ", g.indc, " in chain ", m.idw);
+                indcs[g.ind] = num_edges();
                 gl.emplace_back(g.w, g.indw, g.ind);
             }
         }
+
+    std::ranges::sort(ww, {}, [&](const ChId w) { return cn[w].idc; });
+
+    invalidate_adjacency();
 }
 
 
@@ -900,24 +1178,32 @@ void DisconnectedUnit<Ch>::
 shift_last_edge(const EndSlot& f,
                 const EndSlot& t)
 {
-    auto& g0 = cn[f.w].g;
-    auto& g1 = cn[t.w].g;
+    shift_end_edges(f, t, 1);
+    set_gl();
+}
 
-    ASSERT(cn[f.w].c == cn[t.w].c, "slots belong to differrent components");
 
-    if (f.e == Ends::B) {
-        if (t.e == Ends::A) g1.insert(g1.begin(), std::move(g0.back()));
-        else                g1.push_back(std::move(g0.back()));
-        g0.pop_back();
-    }
-    else {                        // ef == 1
-        if (t.e == Ends::A) g1.insert(g1.begin(), std::move(g0.front()));
-        else                g1.push_back(std::move(g0.front()));
-        g0.erase(g0.begin());
-    }
-    cn[f.w].set_g_w();
-    cn[t.w].set_g_w();
-    set_gl();
+template<typename Ch>
+void DisconnectedUnit<Ch>::
+shift_end_edges(const EndSlot& f,
+                const EndSlot& t,
+                const EgId n)
+{
+    auto& m0 = cn[f.w];
+    auto& m1 = cn[t.w];
+
+    ASSERT(m0.c == m1.c, "slots belong to differrent components");
+    ASSERT(n <= m0.length(), "chain ", f.w, " is shorter than ", n);
+
+    // Only the edges whose position changes are renumbered:
+    auto ee = m0.remove_edges(f.e == Ends::A ? 0 : m0.length() - n, n);
+
+    // Shifted one by one, the edges would be reversed if the link joins
+    // equal ends:
+    if (f.e == t.e)
+        std::ranges::reverse(ee);
+
+    m1.insert_edges(std::move(ee), t.e == Ends::A ? 0 : m1.length());
 }
 
 
@@ -939,6 +1225,48 @@ ww_is_sorted() const noexcept -> bool
 }
 
 
+template<typename Ch>
+void DisconnectedUnit<Ch>::
+adjacent_edges(
+    const Chain& m,
+    const EgId k,
+    std::vector<EgId>& a
+) const noexcept
+{
+    if (m.is_tail(k)) {
+
+        // Connection backwards: only other chains might be found.
+        for (const auto& s : m.ngs[Ends::A]())
+            a.push_back(cn[s.w].g[cn[s.w].end2a(s.e)].indc);
+
+        if (m.length() == 1)
+            // Connection forwards: to other chain.
+            for (const auto& s : m.ngs[Ends::B]())
+                a.push_back(cn[s.w].g[cn[s.w].end2a(s.e)].indc);
+        else
+            // Connection forwards: to the same chain.
+            a.push_back(m.g[k+1].indc);
+    }
+    else if (m.is_head(k)) {
+
+        // Connection backwards: to the same chain.
+        a.push_back(m.g[k-1].indc);
+
+        // Connection forwards: to other chain.
+        for (const auto& s : m.ngs[Ends::B]())
+            a.push_back(cn[s.w].g[cn[s.w].end2a(s.e)].indc);
+    }
+    else {
+
+        // Connection backwards: to the same chain.
+        a.push_back(m.g[k-1].indc);
+
+         // Connection forwards: to the same chain.
+        a.push_back(m.g[k+1].indc);
+    }
+}
+
+
 template<typename Ch>
 auto DisconnectedUnit<Ch>::
 adjacency_list_edges() const noexcept -> vec2<EgId>
@@ -947,40 +1275,8 @@ adjacency_list_edges() const noexcept -> vec2<EgId>
 
     for (const auto j : ww) {
         const auto& m = cn[j];
-        for (EgId k=0; k<m.length(); ++k) {
-            const auto indc = m.g[k].indc;
-            if (m.is_tail(k)) {
-
-                // Connection backwards: only other chains might be found.
-                for (const auto& s : m.ngs[Ends::A]())
-                    a[indc].push_back(cn[s.w].g[cn[s.w].end2a(s.e)].indc);
-
-                if (m.length() == 1)
-                    // Connection forwards: to other chain.
-                    for (const auto& s : m.ngs[Ends::B]())
-                        a[indc].push_back(cn[s.w].g[cn[s.w].end2a(s.e)].indc);
-                else
-                    // Connection forwards: to the same chain.
-                    a[indc].push_back(m.g[k+1].indc);
-            }
-            else if (m.is_head(k)) {
-
-                // Connection backwards: to the same chain.
-                a[indc].push_back(m.g[k-1].indc);
-
-                // Connection forwards: to other chain.
-                for (const auto& s : m.ngs[Ends::B]())
-                    a[indc].push_back(cn[s.w].g[cn[s.w].end2a(s.e)].indc);
-            }
-            else {
-
-                // Connection backwards: to the same chain.
-                a[indc].push_back(m.g[k-1].indc);
-
-                 // Connection forwards: to the same chain.
-                a[indc].push_back(m.g[k+1].indc);
-            }
-        }
+        for (EgId k=0; k<m.length(); ++k)
+            adjacent_edges(m, k, a[m.g[k].indc]);
     }
 
     return a;
@@ -990,7 +1286,11 @@ template<typename Ch>
 void DisconnectedUnit<Ch>::
 adjacency_list_edges() noexcept
 {
-    ajlg = adjacency_list_edges();
+    auto& d = details();
+
+    d.ajlg = std::as_const(*this).adjacency_list_edges();
+    d.ajlgOutdated = false;
+    d.ajlgPending.clear();
 }
 
 template<typename Ch>
@@ -1021,7 +1321,136 @@ template<Orientation dir>
 void DisconnectedUnit<Ch>::
 adjacency_list_chains() noexcept
 {
-    ajlw = adjacency_list_chains<dir>();
+    details().ajlw = std::as_const(*this).template adjacency_list_chains<dir>();
+}
+
+
+template<typename Ch>
+void DisconnectedUnit<Ch>::
+invalidate_adjacency() noexcept
+{
+    // Details allocated anew are outdated anyway:
+    if (!dd)
+        return;
+
+    auto& d = details();
+
+    d.ajlgOutdated = true;
+    d.ajlwOutdated = true;
+    d.ajlgPending.clear();
+    d.weights.kind = WeightClass::unknown;
+}
+
+
+template<typename Ch>
+void DisconnectedUnit<Ch>::
+invalidate_adjacency(const ChId w) noexcept
+{
+    if (!dd)
+        return;
+
+    auto& d = details();
+
+    d.ajlwOutdated = true;
+    if (!d.ajlgOutdated)
+        d.ajlgPending.push_back(w);
+    d.weights.kind = WeightClass::unknown;
+}
+
+
+template<typename Ch>
+void DisconnectedUnit<Ch>::
+invalidate_weights() noexcept
+{
+    if (dd)
+        details().weights.kind = WeightClass::unknown;
+}
+
+
+template<typename Ch>
+template<typename F>
+auto DisconnectedUnit<Ch>::
+weight_class(F&& classify) const -> const WeightClass&
+{
+    auto& wc = details().weights;
+
+    if (wc.kind == WeightClass::unknown)
+        wc = classify();
+
+    return wc;
+}
+
+
+template<typename Ch>
+auto DisconnectedUnit<Ch>::
+edge_adjacency() const -> const vec2<EgId>&
+{
+    auto& d = details();
+    auto& pending = d.ajlgPending;
+
+    // Repeated neighbours would only be relaxed again by the searches:
+    const auto dedup = [](std::vector<EgId>& a) {
+        a.erase(std::unique(a.begin(), a.end()), a.end());
+    };
+
+    if (d.ajlgOutdated || d.ajlg.size() != num_edges()) {
+        d.ajlg = adjacency_list_edges();
+        for (auto& a: d.ajlg)
+            dedup(a);
+        d.ajlgOutdated = false;
+        pending.clear();
+        return d.ajlg;
+    }
+
+    if (pending.empty())
+        return d.ajlg;
+
+    // Rows referring to the end edges of the modified chains:
+    const auto n = pending.size();
+    for (szt i {}; i<n; ++i)
+        if (const auto w = pending[i]; contains_chain(w))
+            for (const auto e: Ends::Ids)
+                for (const auto& s: cn[w].ngs[e]())
+                    pending.push_back(s.w);
+
+    std::ranges::sort(pending);
+    const auto [first, last] = std::ranges::unique(pending);
+    pending.erase(first, last);
+
+    for (const auto w: pending)
+        if (contains_chain(w)) {
+            const auto& m = cn[w];
+            for (EgId k=0; k<m.length(); ++k) {
+                auto& a = d.ajlg[m.g[k].indc];
+                a.clear();
+                adjacent_edges(m, k, a);
+                dedup(a);
+            }
+        }
+
+    pending.clear();
+
+    return d.ajlg;
+}
+
+
+template<typename Ch>
+template<Orientation dir>
+auto DisconnectedUnit<Ch>::
+chain_adjacency() const -> const vec2<ChId>&
+{
+    auto& d = details();
+
+    if (d.ajlwOutdated) {
+        d.ajlwA = adjacency_list_chains<Orientation::Backwards>();
+        d.ajlwB = adjacency_list_chains<Orientation::Forwards>();
+        d.ajlwOutdated = false;
+    }
+
+    if constexpr (dir == Orientation::Backwards)
+        return d.ajlwA;
+    else
+        return d.ajlwB;
 }
 
 
@@ -1029,19 +1458,31 @@ template<typename Ch>
 auto DisconnectedUnit<Ch>::
 find_chains(const EndSlot& source) noexcept -> ChIds
 {
-    reset_search<false>();
-    dfs_<false>(source, EndSlot{});
+    const auto vv = find_chains_view(source);
+    ChIds res (vv.begin(), vv.end());
+
+    const auto isReached = is_defined(search().visited[cn[source.w].idc]);
+
+    // Chains in the ascending order, followed by the source chain
+    // unless it is reached itself:
+    std::ranges::sort(res.begin(), isReached ? res.end() : res.end() - 1);
 
-    ChIds vv {};
+    return res;
+}
 
-    std::copy_if(visited.begin(), visited.end(),
-                 std::back_inserter(vv),
-                 [&](ChId v) { return is_defined(v);});
 
-    if (std::find(vv.begin(), vv.end(), source.w) == vv.end())
-        vv.push_back(source.w);
+template<typename Ch>
+auto DisconnectedUnit<Ch>::
+find_chains_view(const EndSlot& source) noexcept -> std::span<const ChId>
+{
+    reset_search<true>();
+    dfs_<true>(source, EndSlot{});
+
+    auto& d = search();
+    if (is_undefined(d.visited[cn[source.w].idc]))
+        d.reached.push_back(source.w);
 
-   return vv;
+    return d.reached;
 }
 
 
@@ -1081,7 +1522,7 @@ template<typename Ch>
 auto DisconnectedUnit<Ch>::
 chain(const ChId w) const noexcept -> const Chain&
 {
-    ASSERT(std::find(ww.begin(), ww.end(), w) != ww.end(),
+    ASSERT(contains_chain(w),
            "Chain ", w, " is not part of component ", ind);
 
     return cn[w];
@@ -1092,11 +1533,12 @@ template<typename Ch>
 auto DisconnectedUnit<Ch>::
 chid(const ChId idc) const noexcept -> const ChId
 {
-    for (const auto w: ww)
-        if (cn[w].idc == idc)
-            return w;
+    if (idc >= ww.size())
+        return undefined<ChId>;
+
+    ASSERT(cn[ww[idc]].idc == idc, "ww is out of order at idc ", idc);
 
-    return undefined<ChId>;
+    return ww[idc];
 }
 
 
@@ -1104,11 +1546,56 @@ template<typename Ch>
 auto DisconnectedUnit<Ch>::
 ind2indc(EgId ind) const noexcept -> EgId
 {
-    for (EgId i {}; i<gl.size(); ++i)
-        if (gl[i].i == ind)
-            return i;
+    const auto i = indcs.find(ind);
+
+    return i != indcs.end() ? i->second
+                            : undefined<EgId>;
+}
+
+
+template<typename Ch>
+auto DisconnectedUnit<Ch>::
+details() const -> Details&
+{
+    return dd.get(*this);
+}
+
+
+template<typename Ch>
+auto DisconnectedUnit<Ch>::
+search() const -> Search&
+{
+    return sb.get();
+}
+
+
+template<typename Ch>
+constexpr
+auto DisconnectedUnit<Ch>::
+has_details() const noexcept -> bool
+{
+    return static_cast<bool>(dd);
+}
+
+
+template<typename Ch>
+void DisconnectedUnit<Ch>::
+remove_from_ww(const ChId w) noexcept
+{
+    const auto idc = cn[w].idc;
+
+    ASSERT(idc < ww.size() && ww[idc] == w,
+           "Chain ", w, " is not part of component ", ind);
 
-    return undefined<EgId>;
+    // The chain last in ww takes over the position of the chain removed:
+    if (const auto wlast = ww.back(); wlast != w) {
+        ww[idc] = wlast;
+        cn[wlast].idc = idc;
+    }
+    ww.pop_back();
+
+    // Only the position taken over by the former last chain has changed:
+    ASSERT(idc == ww.size() || cn[ww[idc]].idc == idc, "ww is out of order");
 }
 
 
@@ -1132,12 +1619,28 @@ auto DisconnectedUnit<Ch>::
 dfs_(const EndSlot& source,
      const EndSlot& target) -> bool
 {
+    auto& d = search();
+    auto& visited = d.visited;
+    auto& reached = d.reached;
+    auto& trail = d.trail;
+
     if (source == target) {
-        visited[knownSize ? cn[source.w].idc : source.w] = source.w;
+        visited[knownSize ? cn[source.w].idc : ChId {source.w}] = source.w;
+        reached.push_back(source.w);
         return true;
     }
 
-    for (const auto& s : cn[source.w].ngs[source.e]()) {
+    trail.clear();
+    trail.emplace_back(source, 0);
+
+    while (!trail.empty()) {
+        auto& [u, i] = trail.back();
+        const auto& ngs = cn[u.w].ngs[u.e]();
+        if (i == ngs.size()) {
+            trail.pop_back();
+            continue;
+        }
+        const auto s = ngs[i++];
 
         if (cn[s.w].ngs[Ends::opp(s.e)].num() == 0) {
             if (s.w == target.w) {
@@ -1146,11 +1649,11 @@ dfs_(const EndSlot& source,
                 }
             }
             else {
-                const auto n = knownSize ? cn[s.w].idc : s.w;
+                const auto n = knownSize ? cn[s.w].idc : ChId {s.w};
                 if (is_undefined(visited[n])) {
                     visited[n] = s.w;
-                    if (dfs_<knownSize>(s.opp(), target))
-                        return true;
+                    reached.push_back(s.w);
+                    trail.emplace_back(s.opp(), 0);
                 }
             }
         }
@@ -1166,25 +1669,27 @@ auto DisconnectedUnit<Ch>::
 bfs_(std::deque<EndSlot>& q,     // by reference
      const EndSlot& target,
      const EndSlot& source
-) const -> bool
+) -> bool
 {
-    if (q.empty())
-        return false;    // reached end of the search wt finding target
-
-    auto s = std::move(q.front());
-    q.pop_front();
-    if (s.w == target.w)
-        return true;
-
-    for (const auto& ng : cn[s.w].ngs[s.e]()) {
-        const auto n = knownSize ? cn[ng.w].idc : ng.w;
-        if (is_undefined(visited[n])) {
-            visited[n] = ng.w;
-            q.push_back(ng.opp());
+    auto& d = search();
+
+    while (!q.empty()) {
+        const auto s = q.front();
+        q.pop_front();
+        if (s.w == target.w)
+            return true;
+
+        for (const auto& ng : cn[s.w].ngs[s.e]()) {
+            const auto n = knownSize ? cn[ng.w].idc : ng.w;
+            if (is_undefined(d.visited[n])) {
+                d.visited[n] = ng.w;
+                d.reached.push_back(ng.w);
+                q.push_back(ng.opp());
+            }
         }
     }
 
-    return bfs_(q, target);
+    return false;    // reached end of the search wt finding target
 }
 
 
@@ -1193,14 +1698,11 @@ template<bool knownSize>
 void DisconnectedUnit<Ch>::
 reset_search() noexcept
 {
-//    ASSERT(ww_is_sorted(), "ww is out of order");
-
     const auto n = knownSize ? num_chains() : cn.size();
 
-    visited.resize(n);
-    std::fill(visited.begin(),
-              visited.begin() + static_cast<long>(n),
-              undefined<ChId>);
+    auto& d = search();
+    d.visited.reset(n);
+    d.reached.clear();
 }
 
 
@@ -1247,9 +1749,10 @@ template<typename Ch>
 void DisconnectedUnit<Ch>::
 print_adjacency_list_edges(const std::string& tag) const
 {
+    const auto& a = edge_adjacency();
     for (szt j {}; j < num_edges(); ++j) {
         log_<false>(tag, ind, ' ', gl[j].w, ' ', gl[j].a, ' ', gl[j].i, " : ");
-        for (const auto k : ajlg[j])
+        for (const auto k : a[j])
             log_<false>(k, ' ');
         log_("");
     }
@@ -1261,7 +1764,7 @@ template<typename Ch>
 void DisconnectedUnit<Ch>::
 print_adjacency_list_chains(const std::string& tag) const
 {
-    print_adjacency_list_chains(tag, ajlw);
+    print_adjacency_list_chains(tag, details().ajlw);
 }
 
 
@@ -0,0 +1,253 @@
+/* =============================================================================
+
+Copyright (c) 2021-2025 Valerii Sukhorukov <vsukhorukov@yahoo.com>
+All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+================================================================================
+*/
+
+/**
+ * @file edge_payload.h
+ * @brief Contains side tables of user data attached to the graph edges.
+ * @author Valerii Sukhorukov
+ */
+
+#ifndef GRAPH_MUTATOR_STRUCTURE_EDGE_PAYLOAD_H
+#define GRAPH_MUTATOR_STRUCTURE_EDGE_PAYLOAD_H
+
+#include <algorithm>  // erase
+#include <span>
+#include <utility>    // move
+#include <vector>
+
+#include "../definitions.h"
+
+
+namespace graph_mutator::structure {
+
+class EdgeTables;
+
+
+/// Interface through which the graph maintains the edge side tables.
+class EdgeTable {
+
+public:
+
+    virtual ~EdgeTable() = default;
+
+    /// Makes the table hold \p n entries; the new ones are default values.
+    virtual void resize(szt n) = 0;
+
+    /// Moves the entry of edge \p from to that of edge \p to.
+    virtual void move(EgId from, EgId to) = 0;
+
+protected:
+
+    friend class EdgeTables;
+
+    /// Registry the table is attached to; nullptr once it is destroyed.
+    EdgeTables* reg {};
+};
+
+
+/**
+ * @brief Registry of the side tables attached to a graph.
+ * @details Is owned by the graph, which notifies the tables of changes of
+ * the graph-wide edge indexes. The registrations move along with the graph,
+ * while a graph with tables attached may not be copied, as the tables are
+ * owned by the user. Tables attached to a graph assigned to are detached.
+ * A registry destroyed before its tables detaches them, so that they may
+ * outlive the graph, though no longer maintained.
+ */
+class EdgeTables {
+
+public:
+
+    EdgeTables() = default;
+
+    EdgeTables(const EdgeTables& other) noexcept
+    {
+        ASSERT(other.empty(), "EdgeTables: copying a graph having ",
+               other.tt.size(), " side tables attached");
+    }
+
+    EdgeTables(EdgeTables&& other) noexcept
+        : tt {std::move(other.tt)}
+    {
+        other.tt.clear();
+        for (const auto t: tt)
+            t->reg = this;
+    }
+
+    auto operator=(const EdgeTables& other) noexcept -> EdgeTables&
+    {
+        ASSERT(other.empty(), "EdgeTables: copying a graph having ",
+               other.tt.size(), " side tables attached");
+        clear();
+        return *this;
+    }
+
+    auto operator=(EdgeTables&& other) noexcept -> EdgeTables&
+    {
+        if (this == &other)
+            return *this;
+        clear();
+        tt = std::move(other.tt);
+        other.tt.clear();
+        for (const auto t: tt)
+            t->reg = this;
+        return *this;
+    }
+
+    ~EdgeTables()
+    {
+        clear();
+    }
+
+    void attach(EdgeTable* t)
+    {
+        tt.push_back(t);
+        t->reg = this;
+    }
+
+    void detach(EdgeTable* t)
+    {
+        std::erase(tt, t);
+        t->reg = nullptr;
+    }
+
+    constexpr auto empty() const noexcept -> bool { return tt.empty(); }
+
+    /// Detaches all the tables.
+    void clear() noexcept
+    {
+        for (const auto t: tt)
+            t->reg = nullptr;
+        tt.clear();
+    }
+
+    void resize(const szt n) const
+    {
+        for (const auto t: tt)
+            t->resize(n);
+    }
+
+    void move(const EgId from, const EgId to) const
+    {
+        for (const auto t: tt)
+            t->move(from, to);
+    }
+
+private:
+
+    std::vector<EdgeTable*> tt;
+};
+
+
+/**
+ * @brief Per-edge data of type \p P kept outside of the edges.
+ * @details The entries are stored contiguously and indexed by the
+ * graph-wide edge index Edge::ind. The graph keeps the table in step with
+ * its edges: entries are added for new edges, and when an edge is deleted,
+ * the entry of the edge taking over its index is moved in its place.
+ * Chain and component transformations leave the table untouched, as they
+ * do not change Edge::ind.
+ * @note Entries of deleted edges are dropped immediately, while entries of
+ * new edges are added at the next update of the graph books.
+ * @note The table follows the graph it is constructed with, and the graph
+ * that one is moved into; the graph may not be copied while the table is
+ * attached. If the graph is destroyed or assigned to first, the table
+ * keeps its entries but is no longer updated.
+ * @tparam P Type of the data; must be default-constructible.
+ */
+template<typename P>
+class EdgePayload
+    : public EdgeTable {
+
+public:
+
+    /// Constructs a table for the current edges of graph \p gr.
+    template<typename G>
+    explicit EdgePayload(G& gr);
+
+    EdgePayload(const EdgePayload&) = delete;
+    auto operator=(const EdgePayload&) -> EdgePayload& = delete;
+
+    ~EdgePayload() override;
+
+    constexpr auto size() const noexcept -> szt { return vals.size(); }
+
+    auto operator[](EgId i) noexcept -> P& { return vals[i]; }
+    auto operator[](EgId i) const noexcept -> const P& { return vals[i]; }
+
+    /// Entries of all the edges, ordered by the edge index.
+    auto all() noexcept -> std::span<P> { return vals; }
+    auto all() const noexcept -> std::span<const P> { return vals; }
+
+    void resize(szt n) override;
+    void move(EgId from, EgId to) override;
+
+private:
+
+    std::vector<P> vals;    ///< Entries indexed by Edge::ind.
+};
+
+
+// IMPLEMENTATION ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+template<typename P>
+template<typename G>
+EdgePayload<P>::
+EdgePayload(G& gr)
+    : vals(gr.edgenum)
+{
+    gr.payloads.attach(this);
+}
+
+
+template<typename P>
+EdgePayload<P>::
+~EdgePayload()
+{
+    if (reg)
+        reg->detach(this);
+}
+
+
+template<typename P>
+void EdgePayload<P>::
+resize(const szt n)
+{
+    vals.resize(n);
+}
+
+
+template<typename P>
+void EdgePayload<P>::
+move(
+    const EgId from,
+    const EgId to
+)
+{
+    ASSERT(from < size() && to < size(), "EdgePayload: move() from ", from,
+           " to ", to, " is out of range ", size());
+
+    vals[to] = std::move(vals[from]);
+}
+
+
+}  // namespace graph_mutator::structure
+
+#endif  // GRAPH_MUTATOR_STRUCTURE_EDGE_PAYLOAD_H
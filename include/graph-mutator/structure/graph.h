@@ -30,6 +30,7 @@ limitations under the License.
 #include <algorithm>
 #include <array>
 #include <concepts>
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <ranges>
@@ -42,6 +43,7 @@ limitations under the License.
 #include "chain_collection.h"
 #include "chain_indexes.h"
 #include "component.h"
+#include "edge_payload.h"
 #include "vertices/all.h"
 #include "vertices/degrees.h"
 #include "vertices/vertex.h"
@@ -79,6 +81,19 @@ struct Graph {
     using Vertex = vertices::Vertex<D, typename Ch::Slot<D>>;
     using Vertices = vertices::All<Graph>;
     using PathsOverEndSlots = paths::over_endslots::Generic<Cmpt>;
+    using Gen = std::uint32_t;
+
+    /**
+     * @brief Reference to a chain detecting removal or relabeling of it.
+     * @details Is valid while the chain keeps its index: see is_live().
+     */
+    struct ChainHandle {
+
+        ChId w {undefined<ChId>};  ///< Chain index.
+        Gen gen {};                ///< Generation of the chain slot.
+
+        constexpr auto operator==(const ChainHandle&) const -> bool = default;
+    };
 
     /// The collection of chains.
     Chains cn;
@@ -100,11 +115,84 @@ struct Graph {
     /// Mapping of graph-wide edge indexes to element edge position inside chains.
     EgIds gla;
 
+    /// Side tables of per-edge data indexed as glm and gla: see EdgePayload.
+    EdgeTables payloads;
+
+    /// Chains modified since the last update of the books.
+    ChIds touched;
+
+    /// Removed chains are vacated rather than having the last chain renamed
+    /// into their place, so that no other chain is relabeled: see
+    /// remove_chain() and compact_chains().
+    bool keep_chain_ids {};
+
+    /// Component splits move the smaller of the separated sides to the new
+    /// component: see cut_component_at(). Defaults to smaller_side_splits.
+    bool split_smaller_side {smaller_side_splits};
+
+    /// Free list of the vacant chain slots.
+    ChIds vacant;
+
+    /// Generations of the chain slots, advanced whenever the chain in a slot
+    /// is removed or relabeled; slots beyond the end are of generation 0.
+    std::vector<Gen> gens;
+
+    /// Depth of the nested batches currently open: see begin_batch().
+    szt batches {};
+
+    /// A full update of the books is due at the end of the batch.
+    bool rebuild_due {};
+
+    /// Number of the leading entries of touched whose adjacency has been
+    /// invalidated inside the current batch.
+    szt batchTouched {};
+
+    /**
+     * @brief Scope guard opening a batch on construction and committing it
+     * on destruction.
+     */
+    struct Batch {
+
+        Graph& gr;
+
+        explicit Batch(Graph& gr)
+            : gr {gr}
+        {
+            gr.begin_batch();
+        }
+
+        Batch(const Batch&) = delete;
+        Batch& operator=(const Batch&) = delete;
+
+        ~Batch()
+        {
+            gr.commit_batch();
+        }
+    };
+
     /**
      * @brief Constructor.
      */
     constexpr Graph();
 
+    /**
+     * @brief Copy constructor.
+     * @details The chains of the copy update its own glm and gla, and its
+     * components refer to its own chains. Vertices are rebuilt on access.
+     * Edge side tables remain attached to \p other.
+     */
+    Graph(const Graph& other);
+
+    /**
+     * @brief Move constructor.
+     * @details The chains and components are rebound as in the copy.
+     */
+    Graph(Graph&& other) noexcept;
+
+    auto operator=(const Graph& other) -> Graph&;
+    auto operator=(Graph&& other) noexcept -> Graph&;
+    ~Graph() = default;
+
     /**
      * @brief Generate initial set of the graph components.
      * @details The components are single chains of equal length 'len'.
@@ -163,13 +251,31 @@ struct Graph {
         CmpId don
     ) noexcept;
 
+    /**
+     * @brief Splits the component of chain \p s.w if \p s is its only link.
+     * @details Checks whether the ends of chain \p s.w are connected
+     * bypassing the chain. If not, the chains reachable from \p s form
+     * a new component appended to \a ct. With split_smaller_side, the
+     * smaller of the two sides is moved to the new component instead:
+     * either the chains reachable from \p s or the remaining ones,
+     * including \p s.w. A split then takes time proportional to the
+     * smaller side rather than to the component size. Finding that the
+     * ends are connected may still take time proportional to the
+     * component size.
+     * @param s Chain end slot to be disconnected.
+     * @return True if the ends of \p s.w are connected otherwise.
+     */
     auto cut_component_at(const EndSlot& s) -> bool;
 
-    template<bool withSourceChain>
+    /**
+     * @brief Moves chains \p accessible of \p cmp to a new component.
+     * @details Both components are reindexed following the order of
+     * \p accessible and \p blocked, the chains remaining in \p cmp.
+     */
     void split_component(
-        Cmpt& cmp, const
-        PathsOverEndSlots& pp,
-        const EndSlot& s
+        Cmpt& cmp,
+        ChIds&& accessible,
+        ChIds&& blocked
     );
 
     void split_component(Cmpt& cmp, ChIds&& rm);
@@ -177,7 +283,7 @@ struct Graph {
     /// Current number of components.
     constexpr auto cmpt_num() const noexcept -> CmpId { return ct.num(); };
 
-    /// Current number of chains.
+    /// Current number of chains, vacant slots included: see keep_chain_ids.
     constexpr auto chain_num() const noexcept -> ChId { return cn.num(); };
 
     constexpr auto ind_last_cmpt() const noexcept -> CmpId;
@@ -205,6 +311,32 @@ struct Graph {
     /// Calls make_indma() and populate_component_vectors().
     void update_books() noexcept;
 
+    /**
+     * @brief Updates internal data for the modified chains only.
+     * @details Refreshes glm, gla and chis for chains \p ww, the chains
+     * recorded by touch() and the chains connected to their ends; vertices
+     * incident to them are refreshed on the next vertex access.
+     * Entries of chains no longer present in the graph are dropped.
+     * Falls back to the full update_books() if incremental_books is false.
+     * Inside a batch, only records the chains: see begin_batch().
+     * @param ww Indexes of the chains modified.
+     */
+    void update_books(const ChIds& ww) noexcept;
+
+    /**
+     * @brief Records chain \p w as modified for the next incremental update.
+     * @param w Chain index.
+     */
+    void touch(ChId w);
+
+    /**
+     * @brief Checks that the books are identical to those of a full rebuild.
+     * @details Verifies the incremental updates; chis and vertices are
+     * compared irrespective of the element order, and the vertex slot
+     * lookups against the vertices. Is false inside a batch.
+     */
+    auto books_are_current() const -> bool;
+
     /// Updates internal data for component c.
 //    void update_adjacency_cmpt(CmpId c) noexcept;
 
@@ -218,10 +350,47 @@ struct Graph {
     /// Calls update_books() and update_adjacency().
     void update() noexcept;
 
+    /// Updates internal vectors for the modified chains \p ww only.
+    /// Calls update_books(ww) and update_adjacency().
+    void update(const ChIds& ww) noexcept;
+
+    /**
+     * @brief Binds the chains to glm and gla of this graph.
+     * @details Is called by copies and moves of the graph: chain copies are
+     * unbound, and moved chains still refer to the maps of the graph they
+     * come from. A chain is bound if its counterpart in \p src is.
+     * @param src Chains of the graph copied or moved from.
+     */
+    void rebind_chains(const Chains& src) noexcept;
+
+    /**
+     * @brief Opens a batch of transformations sharing a single update.
+     * @details Inside a batch, update() and update_books() only record the
+     * chains modified and bind new chains to glm and gla. Component chain
+     * indexes, glm and gla thus remain current, and the cached component
+     * adjacency is refreshed on access for the recorded chains, including
+     * those recorded by touch(), and the chains connected to their ends. chis and
+     * vertices are updated once by the closing commit_batch() and must not
+     * be queried before it: the vertex accessors assert that.
+     * Batches may be nested.
+     */
+    void begin_batch() noexcept;
+
+    /**
+     * @brief Closes the batch opened by begin_batch().
+     * @details Closing the outermost batch updates the books for all the
+     * chains modified inside it.
+     */
+    void commit_batch() noexcept;
+
     /// Initializes or updates glm and gla vectors.
     /// Sets 'glm' and 'gla':
     void make_indma() noexcept;
 
+    /// Binds chain \p w to glm and gla and records its edges there.
+    /// Once bound, the chain edge primitives keep both maps current.
+    void make_indma(ChId w) noexcept;
+
     /**
      * @brief Initializes or updates adjacency list.
      * @param a The adjacency list.
@@ -302,6 +471,44 @@ struct Graph {
      */
     void rename_chain(ChId f, ChId t);
 
+    /**
+     * @brief Removes chain \p w, which is devoid of edges and no longer part
+     * of a component.
+     * @details If keep_chain_ids is set, \p w is vacated. Otherwise, the last
+     * chain is renamed to \p w, so that the chains remain contiguous.
+     * @param w Index of the chain removed.
+     */
+    void remove_chain(ChId w);
+
+    /**
+     * @brief Leaves chain \p w in place as a vacant slot.
+     * @details Clears the connections of \p w and adds it to the free list.
+     * Vacant slots are reused by add_single_chain_component() or removed by
+     * compact_chains().
+     * @param w Index of the chain vacated.
+     */
+    void vacate_chain(ChId w);
+
+    /**
+     * @brief Removes the vacant chain slots.
+     * @details Vacant slots at the end are dropped, and each of the others
+     * is taken by the chain currently last, which is relabeled. Is meant to
+     * be called rarely, e.g. before export.
+     */
+    void compact_chains();
+
+    /// Generation of chain slot \p w.
+    constexpr auto generation(ChId w) const noexcept -> Gen;
+
+    /// Invalidates the handles to chain slot \p w.
+    void advance_generation(ChId w);
+
+    /// Handle to chain \p w.
+    constexpr auto handle(ChId w) const noexcept -> ChainHandle;
+
+    /// Checks if the chain referenced by \p h still has the index h.w.
+    constexpr auto is_live(const ChainHandle& h) const noexcept -> bool;
+
     /**
      * @brief Copies connection partners to a new chain.
      * @details Copies assigning the connected slots of \p f to \p t and
@@ -362,6 +569,140 @@ Graph()
 {}
 
 
+template<typename Ch>
+Graph<Ch>::
+Graph(const Graph& other)
+    : cn {other.cn}
+    , chis {other.chis}
+    , vertices {*this}
+    , edgenum {other.edgenum}
+    , glm {other.glm}
+    , gla {other.gla}
+    , payloads {other.payloads}
+    , touched {other.touched}
+    , keep_chain_ids {other.keep_chain_ids}
+    , split_smaller_side {other.split_smaller_side}
+    , vacant {other.vacant}
+    , gens {other.gens}
+    , batches {other.batches}
+    , rebuild_due {other.rebuild_due}
+    , batchTouched {other.batchTouched}
+{
+    ct.reserve(other.cmpt_num());
+    for (const auto& c: other.ct)
+        ct.emplace_back(c, cn);
+
+    rebind_chains(other.cn);
+}
+
+
+template<typename Ch>
+Graph<Ch>::
+Graph(Graph&& other) noexcept
+    : cn {std::move(other.cn)}
+    , chis {std::move(other.chis)}
+    , vertices {*this}
+    , edgenum {other.edgenum}
+    , glm {std::move(other.glm)}
+    , gla {std::move(other.gla)}
+    , payloads {std::move(other.payloads)}
+    , touched {std::move(other.touched)}
+    , keep_chain_ids {other.keep_chain_ids}
+    , split_smaller_side {other.split_smaller_side}
+    , vacant {std::move(other.vacant)}
+    , gens {std::move(other.gens)}
+    , batches {other.batches}
+    , rebuild_due {other.rebuild_due}
+    , batchTouched {other.batchTouched}
+{
+    ct.reserve(other.cmpt_num());
+    for (auto& c: other.ct)
+        ct.emplace_back(std::move(c), cn);
+    other.ct.clear();
+
+    rebind_chains(cn);
+}
+
+
+template<typename Ch>
+auto Graph<Ch>::
+operator=(const Graph& other) -> Graph&
+{
+    if (this == &other)
+        return *this;
+
+    cn = other.cn;
+    chis = other.chis;
+    edgenum = other.edgenum;
+    glm = other.glm;
+    gla = other.gla;
+    payloads = other.payloads;
+    touched = other.touched;
+    keep_chain_ids = other.keep_chain_ids;
+    split_smaller_side = other.split_smaller_side;
+    vacant = other.vacant;
+    gens = other.gens;
+    batches = other.batches;
+    rebuild_due = other.rebuild_due;
+    batchTouched = other.batchTouched;
+
+    ct.clear();
+    ct.reserve(other.cmpt_num());
+    for (const auto& c: other.ct)
+        ct.emplace_back(c, cn);
+
+    rebind_chains(other.cn);
+
+    return *this;
+}
+
+
+template<typename Ch>
+auto Graph<Ch>::
+operator=(Graph&& other) noexcept -> Graph&
+{
+    if (this == &other)
+        return *this;
+
+    cn = std::move(other.cn);
+    chis = std::move(other.chis);
+    edgenum = other.edgenum;
+    glm = std::move(other.glm);
+    gla = std::move(other.gla);
+    payloads = std::move(other.payloads);
+    touched = std::move(other.touched);
+    keep_chain_ids = other.keep_chain_ids;
+    split_smaller_side = other.split_smaller_side;
+    vacant = std::move(other.vacant);
+    gens = std::move(other.gens);
+    batches = other.batches;
+    rebuild_due = other.rebuild_due;
+    batchTouched = other.batchTouched;
+
+    ct.clear();
+    ct.reserve(other.cmpt_num());
+    for (auto& c: other.ct)
+        ct.emplace_back(std::move(c), cn);
+    other.ct.clear();
+
+    rebind_chains(cn);
+
+    return *this;
+}
+
+
+template<typename Ch>
+void Graph<Ch>::
+rebind_chains(const Chains& src) noexcept
+{
+    for (ChId w {}; w<chain_num(); ++w)
+        if (src[w].glm)
+            cn[w].bind_indma(glm, gla);
+
+    vertices.invalidate();
+}
+
+
 template<typename Ch>
 void Graph<Ch>::
 generate_single_chain_components(
@@ -369,10 +710,13 @@ generate_single_chain_components(
     const EgId len
 )
 {
-    const auto n {chain_num()};      // number of chains already present
+    cn.reserve(chain_num() + num);
+    ct.reserve(cmpt_num() + num);
+    glm.reserve(edgenum + num * len);
+    gla.reserve(edgenum + num * len);
 
-    while (chain_num() < num + n)
-        add_single_chain_component(len, chain_num());
+    for (CmpId i {}; i<num; ++i)
+        add_single_chain_component(len);
 
     log_("Generated ", colorcodes::GREEN, num, colorcodes::RESET,
          " identical single-chain components, to ", edgenum, " edges total");
@@ -386,14 +730,29 @@ add_single_chain_component(
     const ChId idw
 )
 {
+    // A vacant slot is taken unless the index is given explicitly:
+    if (is_undefined(idw) && !vacant.empty()) {
+        const auto w = vacant.back();
+        vacant.pop_back();
+        // handles taken while the slot was vacant do not refer to the chain:
+        advance_generation(w);
+        cn[w] = Chain {len, w, edgenum};
+        edgenum += len;
+        make_indma(w);
+        ct.emplace_back(cn[w], cmpt_num(), cn);
+        update({w});
+        return;
+    }
+
     cn.emplace_back(len,
                     is_defined(idw) ? idw : chain_num(),
                     edgenum);
     edgenum += len;
+    make_indma(ind_last_chain());
 
     ct.emplace_back(cn.back(), cmpt_num(), cn);
 
-    update();
+    update({ind_last_chain()});
 }
 
 
@@ -403,6 +762,7 @@ add_component(Chains&& mm)
 {
     ct.emplace_back(cmpt_num(), cn);  // empty
 
+    ChIds ww;
     for (auto&& m : mm) {
 
         for (auto& g : m.g)
@@ -411,11 +771,13 @@ add_component(Chains&& mm)
         if (is_undefined(m.idw))
             m.set_w(chain_num());
         cn.push_back(std::move(m));
+        make_indma(ind_last_chain());
 
         ct.back().append(cn.back());
+        ww.push_back(ind_last_chain());
     }
 
-    update();
+    update(ww);
 }
 
 
@@ -430,20 +792,33 @@ cut_component_at(const EndSlot& s) -> bool
 
     paths::over_endslots::Generic<Cmpt> pp {cmp};
 
-    // this is true iff there is a connection to s2 via a path outgoing from 's'
-    // knownSize is true: enumertate over the cluster
-    const auto is_cycle = pp.template are_connected<false>(s, s.opp());
+    // this is true iff there is a connection to s.opp() via a path
+    // outgoing from 's' and bypassing chain s.w
+    const auto is_cycle = pp.is_cycled_over(s);
 
     if constexpr (verboseF) {
         const auto ckl = is_cycle ? "" : "not ";
         log_("Component ", cmp.ind, " is ", ckl, "cycled over chain ", s.w);
     }
 
-    if (!is_cycle)
-        // create a new component from 's' neigs and beyond
-        // (excluding s.w itself):
-
-        split_component<false>(cmp, pp, s);
+    if (!is_cycle) {
+        if (split_smaller_side)
+            split_component(cmp, ChIds {pp.separated_chains()});
+        else {
+            // create a new component from 's' neigs and beyond
+            // (excluding s.w itself), which is either the side found by
+            // is_cycled_over() or the rest of the component:
+            const auto& sep = pp.separated_chains();
+            const auto atSource = pp.separated_at_source();
+            ChIds accessible;
+            ChIds blocked;
+            for (const auto w: cmp.ww)
+                w != s.w && std::ranges::binary_search(sep, w) == atSource
+                    ? accessible.push_back(w)
+                    : blocked.push_back(w);
+            split_component(cmp, std::move(accessible), std::move(blocked));
+        }
+    }
 
     return is_cycle;
 }
@@ -458,40 +833,41 @@ mark_branch(const EndSlot& source) -> bool
 
     PathsOverEndSlots pp {cmp};
 
-    return pp.template are_connected<false>(source, source.opp());
+    return pp.is_cycled_over(source);
 }
 
 
 template<typename Ch>
-template<bool withSourceChain>
 void Graph<Ch>::
 split_component(
     Cmpt& cmp,
-    const PathsOverEndSlots& pp,
-    const EndSlot& s
+    ChIds&& accessible,
+    ChIds&& blocked
 )
 {
-    auto [accessible, blocked] =
-        pp.template classify_chains_by_connectivity<withSourceChain>(s);
-
     if constexpr (verboseF)
         cmp.template print_classification<false>(accessible, blocked);
 
+    // The component container may reallocate:
+    const auto c = cmp.ind;
     const auto newc = cmpt_num();
     auto& newcmp = ct.emplace_back(newc, cn);
+    auto& oldcmp = ct[c];
 
-    newcmp.ww = accessible;
-    for (EgId indc {}, j {}; const auto w: accessible)
+    // Only the entries of the moved chains change their component:
+    for (const auto w: accessible)
+        oldcmp.chis.remove(w);
+    newcmp.chis.populate(cn, accessible);
+
+    newcmp.ww = std::move(accessible);
+    for (EgId indc {}, j {}; const auto w: newcmp.ww)
         indc = cn[w].set_cmpt(newc, j++, indc);
     newcmp.set_gl();
-    newcmp.set_chis();
-
 
-    cmp.ww = blocked;
-    for (EgId indc {}, j {}; const auto w: blocked)
-        indc = cn[w].set_cmpt(cmp.ind, j++, indc);
-    cmp.set_gl();
-    cmp.set_chis();
+    oldcmp.ww = std::move(blocked);
+    for (EgId indc {}, j {}; const auto w: oldcmp.ww)
+        indc = cn[w].set_cmpt(c, j++, indc);
+    oldcmp.set_gl();
 }
 
 
@@ -499,10 +875,12 @@ template<typename Ch>
 void Graph<Ch>::
 split_component(Cmpt& cmp, ChIds&& rm)
 {
+    // The component container may reallocate:
+    const auto c = cmp.ind;
     const auto newc = cmpt_num();
     auto& newcmp = ct.emplace_back(newc, cn);
 
-    cmp.move_to(newcmp, std::move(rm));
+    ct[c].move_to(newcmp, std::move(rm));
 }
 
 
@@ -756,6 +1134,113 @@ rename_chain(const ChId f, const ChId t)
     cn[t].c = cn[f].c;
     cn[t].idc = cn[f].idc;
     ct[cn[f].c].rename_chain(f, t);
+
+    advance_generation(f);
+    advance_generation(t);
+
+    touch(f);
+    touch(t);
+}
+
+
+template<typename Ch>
+void Graph<Ch>::
+remove_chain(const ChId w)
+{
+    ASSERT(cn[w].is_vacant(), "removing chain ", w, " which still has edges");
+
+    if (keep_chain_ids) {
+        vacate_chain(w);
+        return;
+    }
+
+    advance_generation(w);
+    if (w != ind_last_chain())
+        rename_chain(ind_last_chain(), w);
+    cn.pop_back();
+}
+
+
+template<typename Ch>
+void Graph<Ch>::
+vacate_chain(const ChId w)
+{
+    auto& m = cn[w];
+
+    ASSERT(m.is_vacant(), "vacating chain ", w, " which still has edges");
+
+    // The connections have been transferred to other chains,
+    // which no longer refer to w:
+    for (const auto e: Ends::Ids)
+        m.ngs[e].clear();
+    m.c = undefined<CmpId>;
+    m.idc = undefined<ChId>;
+
+    advance_generation(w);
+    vacant.push_back(w);
+
+    touch(w);
+}
+
+
+template<typename Ch>
+void Graph<Ch>::
+compact_chains()
+{
+    // Slots are filled in the ascending order,
+    // so that those left at the end are simply dropped:
+    std::ranges::sort(vacant);
+
+    for (const auto w: vacant) {
+        while (chain_num() && cn.back().is_vacant())
+            cn.pop_back();
+        if (w >= chain_num())
+            continue;
+        rename_chain(ind_last_chain(), w);
+        cn.pop_back();
+    }
+    vacant.clear();
+
+    update(ChIds {});
+}
+
+
+template<typename Ch>
+constexpr
+auto Graph<Ch>::
+generation(const ChId w) const noexcept -> Gen
+{
+    return w < gens.size() ? gens[w] : Gen {};
+}
+
+
+template<typename Ch>
+void Graph<Ch>::
+advance_generation(const ChId w)
+{
+    if (w >= gens.size())
+        gens.resize(w + 1);
+    ++gens[w];
+}
+
+
+template<typename Ch>
+constexpr
+auto Graph<Ch>::
+handle(const ChId w) const noexcept -> ChainHandle
+{
+    return {w, generation(w)};
+}
+
+
+template<typename Ch>
+constexpr
+auto Graph<Ch>::
+is_live(const ChainHandle& h) const noexcept -> bool
+{
+    return h.w < chain_num() &&
+           !cn[h.w].is_vacant() &&
+           generation(h.w) == h.gen;
 }
 
 
@@ -770,6 +1255,8 @@ copy_neigs(
 
    // Substitute f in f's neig's neigs for t:
     replace_slot_in_neigs(f, t);
+
+    touch(f.w);
 }
 
 
@@ -780,8 +1267,12 @@ remove_slot_from_neigs(const EndSlot& s)
     const auto sc = ngs_at(s);  // copy
     auto&      sr = ngs_at(s);  // ref
 
+    touch(s.w);
+
     for (auto& ne : sc()) {
 
+        touch(ne.w);
+
         auto& ngs = ngs_at(ne);
 
         // Remove oldn from the neig list of its j-th neig
@@ -810,8 +1301,12 @@ replace_slot_in_neigs(
 {
     const auto& nov_ngs = ngs_at(nov);
 
+    touch(nov.w);
+
     for (auto& ne : nov_ngs()) {
 
+        touch(ne.w);
+
         auto& ne_ngs = ngs_at(ne);
 
         const auto ok = ne_ngs.replace(old, nov);
@@ -827,8 +1322,19 @@ void Graph<Ch>::
 update_books() noexcept
 {
     make_indma();
+    if (batches) {
+        rebuild_due = true;
+        vertices.invalidate();
+        for (auto& c: ct)
+            c.invalidate_adjacency();
+        return;
+    }
     chis.populate(cn);
-    vertices.create();
+    vertices.invalidate();
+    for (auto& c: ct)
+        c.invalidate_adjacency();
+    touched.clear();
+    batchTouched = 0;
 //    std::cout << "num 0 " << vertices.template num<0>() << std::endl;
 //    std::cout << "num 1 " << vertices.template num<1>() << std::endl;
 //    std::cout << "num 2 " << vertices.template num<2>() << std::endl;
@@ -842,12 +1348,169 @@ update_books() noexcept
 }
 
 
+template<typename Ch>
+void Graph<Ch>::
+update_books(const ChIds& ww) noexcept
+{
+    if constexpr (!incremental_books) {
+        update_books();
+        return;
+    }
+
+    touched.insert(touched.end(), ww.begin(), ww.end());
+
+    if (batches) {
+        // The chains recorded since the previous call and those connected
+        // to their ends, as below:
+        ChIds uu;
+        for (auto i=batchTouched; i<touched.size(); ++i)
+            if (const auto w = touched[i]; w < chain_num()) {
+                uu.push_back(w);
+                for (const auto e: Ends::Ids)
+                    for (const auto& s: cn[w].ngs[e]())
+                        uu.push_back(s.w);
+            }
+        batchTouched = touched.size();
+
+        glm.resize(edgenum);
+        gla.resize(edgenum);
+        payloads.resize(edgenum);
+        for (const auto w: uu) {
+            if (!cn[w].is_bound_to(glm, gla))
+                make_indma(w);
+            if (cn[w].c < cmpt_num())
+                ct[cn[w].c].invalidate_adjacency(w);
+        }
+        vertices.invalidate(uu);
+        return;
+    }
+
+    // Chains connected to the modified ones may have changed their end degrees:
+    for (szt i {}, n {touched.size()}; i<n; ++i)
+        if (const auto w = touched[i]; w < chain_num())
+            for (const auto e: Ends::Ids)
+                for (const auto& s: cn[w].ngs[e]())
+                    touched.push_back(s.w);
+
+    std::ranges::sort(touched);
+    const auto [first, last] = std::ranges::unique(touched);
+    touched.erase(first, last);
+
+    // glm and gla are maintained by the chain edge primitives;
+    // only chains not yet bound to them are recorded here:
+    glm.resize(edgenum);
+    gla.resize(edgenum);
+    payloads.resize(edgenum);
+    for (const auto w: touched)
+        if (w < chain_num() && !cn[w].is_bound_to(glm, gla))
+            make_indma(w);
+
+    chis.update(cn, touched);
+    vertices.invalidate(touched);
+    for (const auto w: touched)
+        if (w < chain_num() && cn[w].c < cmpt_num())
+            ct[cn[w].c].invalidate_adjacency(w);
+
+    touched.clear();
+    batchTouched = 0;
+}
+
+
+template<typename Ch>
+void Graph<Ch>::
+touch(const ChId w)
+{
+    if constexpr (incremental_books)
+        touched.push_back(w);
+}
+
+
+template<typename Ch>
+auto Graph<Ch>::
+books_are_current() const -> bool
+{
+    if (batches)
+        return false;
+
+    ChIds glm0(edgenum);
+    EgIds gla0(edgenum);
+    for (const auto& m: cn)
+        for (const auto& g: m.g) {
+            glm0[g.ind] = m.idw;
+            gla0[g.ind] = g.indw;
+        }
+
+    if (glm != glm0 || gla != gla0)
+        return false;
+
+    if (!chis.positions_are_consistent())
+        return false;
+    for (const auto& c: ct)
+        if (!c.chis.positions_are_consistent())
+            return false;
+
+    ChainIndexes<false, EndSlot> chis0;
+    chis0.populate(cn);
+
+    const auto same = [](auto a, auto b)
+    {
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+        return a == b;
+    };
+
+    if (!same(chis.cn11, chis0.cn11) || !same(chis.cn22, chis0.cn22) ||
+        !same(chis.cn33, chis0.cn33) || !same(chis.cn44, chis0.cn44) ||
+        !same(chis.cn13, chis0.cn13) || !same(chis.cn14, chis0.cn14) ||
+        !same(chis.cn34, chis0.cn34))
+        return false;
+
+    for (const auto& c: ct) {
+        ChainIndexes<true, EndSlot> cchis0;
+        cchis0.populate(cn, c.ww);
+        if (c.chis.cn11 != cchis0.cn11 || c.chis.cn22 != cchis0.cn22 ||
+            !same(c.chis.cn33, cchis0.cn33) || !same(c.chis.cn44, cchis0.cn44) ||
+            !same(c.chis.cn13, cchis0.cn13) || !same(c.chis.cn14, cchis0.cn14) ||
+            !same(c.chis.cn34, cchis0.cn34))
+            return false;
+    }
+
+    vertices.number();
+
+    Vertices vertices0 {*this};
+    vertices0.create();
+
+    const auto same_vertices = [](const auto& a, const auto& b)
+    {
+        const auto found = [&](const auto& v, const auto& s)
+        {
+            return vertices::find_vertex(s, a) == v.ind;
+        };
+
+        for (const auto& v: a.vv)
+            if (v.isBulk ? !found(v, v.ars.back())
+                         : !std::ranges::all_of(v.ars, [&](const auto& s)
+                                                { return found(v, s); }))
+                return false;
+
+        return std::is_permutation(a.vv.begin(), a.vv.end(),
+                                   b.vv.begin(), b.vv.end());
+    };
+
+    return same_vertices(std::get<0>(vertices.all), std::get<0>(vertices0.all)) &&
+           same_vertices(std::get<1>(vertices.all), std::get<1>(vertices0.all)) &&
+           same_vertices(std::get<2>(vertices.all), std::get<2>(vertices0.all)) &&
+           same_vertices(std::get<3>(vertices.all), std::get<3>(vertices0.all)) &&
+           same_vertices(std::get<4>(vertices.all), std::get<4>(vertices0.all));
+}
+
+
 template<typename Ch>
 void Graph<Ch>::
 update_adjacency_edges(const EgId ind) noexcept
 {
     const auto c = cn[glm[ind]].c;
-    ct[c].adjacency_list_edges();
+    ct[c].edge_adjacency();
 }
 
 
@@ -855,8 +1518,8 @@ template<typename Ch>
 void Graph<Ch>::
 update_adjacency() noexcept
 {
-    for (auto& c: ct)
-        c.adjacency_list_edges();
+    for (const auto& c: ct)
+        c.edge_adjacency();
 }
 
 
@@ -866,7 +1529,45 @@ update() noexcept
 {
     update_books();
     if constexpr (useAgl)
-        update_adjacency();
+        if (!batches)
+            update_adjacency();
+}
+
+
+template<typename Ch>
+void Graph<Ch>::
+update(const ChIds& ww) noexcept
+{
+    update_books(ww);
+    if constexpr (useAgl)
+        if (!batches)
+            update_adjacency();
+}
+
+
+template<typename Ch>
+void Graph<Ch>::
+begin_batch() noexcept
+{
+    ++batches;
+}
+
+
+template<typename Ch>
+void Graph<Ch>::
+commit_batch() noexcept
+{
+    ASSERT(batches, "commit_batch() is called outside of a batch");
+
+    if (--batches)
+        return;
+
+    if (rebuild_due) {
+        rebuild_due = false;
+        update();
+    }
+    else
+        update(ChIds {});
 }
 
 
@@ -879,11 +1580,23 @@ make_indma() noexcept
 
     glm.resize(edgenum);
     gla.resize(edgenum);
-    for (const auto& m: cn)
+    payloads.resize(edgenum);
+    for (auto& m: cn) {
+        m.bind_indma(glm, gla);
         for (const auto& g: m.g) {
             glm[g.ind] = m.idw;
             gla[g.ind] = g.indw;
         }
+    }
+}
+
+
+template<typename Ch>
+void Graph<Ch>::
+make_indma(const ChId w) noexcept
+{
+    cn[w].bind_indma(glm, gla);
+    cn[w].set_indma();
 }
 
 
@@ -79,6 +79,8 @@ struct IntegralTests {
 
     /**
      * @brief Tests correctness of chain indexes.
+     * @details Also ensures that the vacant chain slots are those listed in
+     * the graph free list.
      * @param it Index of the current iteration.
      */
     void chain_id(itT it) const;
@@ -96,6 +98,12 @@ struct IntegralTests {
      */
     void chain_g(itT it) const;
 
+    /**
+     * @brief Tests the incrementally updated books against a full rebuild.
+     * @param it Index of the current iteration.
+     */
+    void books(itT it) const;
+
 private:
 
     const Graph& gr;  ///< Reference to the graph object.
@@ -142,6 +150,7 @@ operator()(const itT it) const
     edges(it);
     chain_g(it);
     vertex_numbers(it);
+    books(it);
 }
 
 /*
@@ -192,15 +201,14 @@ template<typename G>
 void IntegralTests<G>::
 components(const itT it) const
 {
-    const auto nc = gr.chain_num();
-
-    if (!nc) return;
+    // min and max component indexes in chains, vacant slots excluded
 
-    // min and max component indexes in chains
+    std::vector<CmpId> cids;
+    for (const auto& m: cn)
+        if (!m.is_vacant())
+            cids.push_back(m.c);
 
-    std::vector<CmpId> cids(nc);
-    for (ChId i=0; i<nc; ++i)
-        cids[i] = cn[i].c;
+    if (cids.empty()) return;
 
     const auto maxv = *std::max_element(cids.begin(), cids.end());
 
@@ -266,6 +274,8 @@ components(const itT it) const
     }
 */
     for (const auto& c : ct) {
+        ENSURE(c.ww_is_sorted(), "at iter ", it, " ww is out of order in ", c.ind);
+
         for (const auto w : c.ww) {
 
             ENSURE(cn[w].c == c.ind,
@@ -526,6 +536,20 @@ chain_id(const itT it) const
             "should have ind ",
             "Error 1: at iteration ", it," check.chain_id faied at ind ", i
         );
+
+    ChIds vacant;
+    for (const auto& m: cn)
+        if (m.is_vacant()) {
+            ENSURE(is_undefined(m.c) &&
+                   !m.is_connected_at(Ends::A) && !m.is_connected_at(Ends::B),
+                   "Error 2: at iteration ", it,
+                   " vacant chain ", m.idw, " is still in use");
+            vacant.push_back(m.idw);
+        }
+
+    ENSURE(std::ranges::is_permutation(vacant, gr.vacant),
+           "Error 3: at iteration ", it,
+           " vacant chains differ from the free list");
 }
 
 
@@ -579,6 +603,16 @@ chain_g(const itT it) const
 }
 
 
+template<typename G>
+void IntegralTests<G>::
+books(const itT it) const
+{
+    ENSURE(gr.books_are_current(),
+           "books test failed at iteration ", it,
+           ": incremental update differs from the full rebuild");
+}
+
+
 }  // namespace graph_mutator::structure
 
 #endif  // GRAPH_MUTATOR_STRUCTURE_INTEGRAL_TESTS_H
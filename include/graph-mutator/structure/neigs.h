@@ -27,11 +27,12 @@ limitations under the License.
 #ifndef GRAPH_MUTATOR_STRUCTURE_NEIGS_H
 #define GRAPH_MUTATOR_STRUCTURE_NEIGS_H
 
+#include <algorithm>  // is_permutation
 #include <array>
 #include <iostream>
-#include <vector>
 
 #include "../definitions.h"
+#include "../inline_vector.h"
 #include "ends.h"
 #include "slot.h"
 #include "vertices/vertex.h"
@@ -44,7 +45,8 @@ namespace graph_mutator::structure {
  * @brief Container holding slots connected to the current one.
  * @details This container holds all the slots that are directly connected to
  * the current slot in the chain. It provides methods to add, remove, and access
- * the connected slots.
+ * the connected slots. As there are at most \a maxNum of them, the slots are
+ * stored in place, which keeps chain copies free of heap allocations.
  */
 template<typename S>
 struct Neigs {
@@ -52,7 +54,7 @@ struct Neigs {
     static constexpr auto maxNum = maxDegree - 1;
 
     template<typename T>
-    using container = std::vector<T>;
+    using container = InlineVector<T, maxNum>;
 
     using Slot = S;
     using Slots = container<Slot>;
@@ -97,19 +99,10 @@ struct Neigs {
 
     constexpr auto operator==(const Neigs& other) const noexcept -> bool
     {
-        if (num() != other.num())
-            return false;
-
-        if (num() > 1) {
-            auto ss = ss_;
-            std::sort(ss.begin(), ss.end());
-            auto oss = other.ss_;
-            std::sort(oss.begin(), oss.end());
-            return ss == oss;
-        }
-        else
-            return ss_ == other.ss_;
-
+        // The order of the slots is irrelevant; for at most maxNum slots,
+        // the pairwise comparison is cheaper than sorting copies:
+        return num() == other.num() &&
+               std::is_permutation(ss_.begin(), ss_.end(), other.ss_.begin());
     }
 
     constexpr auto operator[](const szt i) const noexcept -> const Slot&
@@ -0,0 +1,333 @@
+/* =============================================================================
+
+Copyright (c) 2021-2025 Valerii Sukhorukov <vsukhorukov@yahoo.com>
+All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+================================================================================
+*/
+
+/**
+ * @file contracted.h
+ * @brief Shortest paths over graph edges computed on the graph of chain ends.
+ * @author Valerii Sukhorukov
+ */
+
+#ifndef GRAPH_MUTATOR_STRUCTURE_PATHS_OVER_EDGES_CONTRACTED_H
+#define GRAPH_MUTATOR_STRUCTURE_PATHS_OVER_EDGES_CONTRACTED_H
+
+#include <array>
+#include <deque>
+#include <vector>
+
+#include "../../../definitions.h"
+#include "../queues.h"
+#include "../workspace.h"
+
+
+namespace graph_mutator::structure::paths::over_edges {
+
+/**
+ * @brief Shortest paths over edges of a graph component.
+ * @details Finds a shortest path between the same edges as
+ * Generic::find_shortest_path(), but runs Dijkstra's algorithm over the
+ * chain end slots rather than over edges. Moving along a chain costs the
+ * weights of its edges except the entry one; moving across a vertex costs
+ * the weight of the end edge entered. If several paths are equally short,
+ * the one returned may differ from that of Generic. The weight of each chain
+ * reached is summed once per search, and the edges internal to chains are
+ * otherwise only visited when the path is expanded.
+ * @tparam Component Graph component type.
+ */
+template<typename Component>
+struct Contracted {
+
+    using Chain = Component::Chain;
+    using Edge = Chain::Edge;
+    using EndSlot = Chain::EndSlot;
+    using Ends = Edge::Ends;
+    using EdgeWeight = typename Edge::weight_t;
+
+    /// Type alias for path over consecutively connected edges.
+    using Path = std::deque<EgId>;
+
+    Component const* cmp {};   ///< Pointer to the graph component.
+
+    explicit Contracted(Component const* const cmp);
+
+    /**
+     * \brief The shortest path between two edges of the component.
+     * \param[in] s1 indc of the first edge of the path.
+     * \param[in] s2 indc of the last edge of the path.
+     * \return The shortest path as a sequence of component-wide edge indexes,
+     * empty if \p s2 is not reachable from \p s1.
+     */
+    auto find_shortest_path(
+        EgId s1,
+        EgId s2
+    ) -> Path;
+
+private:
+
+    static constexpr auto inf = Edge::maxWeight;
+
+    /// Search state of a chain end slot.
+    struct Label {
+        EdgeWeight dist {inf};      ///< Distance to the chain end edge.
+        szt prev {undefined<szt>};  ///< Preceding chain end slot.
+        bool across {};             ///< The slot is entered across a vertex.
+    };
+
+    /// Storage reused by the computations, see WorkspacePool.
+    struct Workspace {
+        StampedArray<Label> labels;
+        IndexedHeap<EdgeWeight> q;
+        StampedArray<EdgeWeight> weights {inf};  ///< Chain weights by idc.
+    };
+
+    typename WorkspacePool<Workspace>::Lease ws;
+
+    StampedArray<Label>& labels;
+    IndexedHeap<EdgeWeight>& q;
+    StampedArray<EdgeWeight>& weights;
+
+    void reset();
+
+    /// Index of the end slot \p s among the component slots.
+    constexpr auto element_ind(const EndSlot& s) const noexcept -> szt;
+
+    constexpr auto element(szt i) const noexcept -> EndSlot;
+
+    void relax(szt u, szt v, EdgeWeight d, bool isAcross);
+
+    /// Weight of chain \p m, summed on the first call during a search.
+    auto weight(const Chain& m) -> EdgeWeight;
+
+    /// Sums weights of edges of chain \p m at positions [\p a1, \p a2).
+    static auto span(const Chain& m, EgId a1, EgId a2) noexcept -> EdgeWeight;
+
+    /// Appends to \p path edges of chain \p m from position \p a1 to \p a2.
+    static void walk(const Chain& m, EgId a1, EgId a2, bool withFirst,
+                     Path& path);
+};
+
+
+// IMPLEMENTATION ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+template<typename Component>
+Contracted<Component>::
+Contracted(Component const* const cmp)
+    : cmp {cmp}
+    , ws {WorkspacePool<Workspace>::acquire()}
+    , labels {ws->labels}
+    , q {ws->q}
+    , weights {ws->weights}
+{
+    ASSERT(cmp, "Pointer to Component is null");
+}
+
+
+template<typename Component>
+void Contracted<Component>::
+reset()
+{
+    const auto n = 2 * static_cast<szt>(cmp->num_chains());
+
+    labels.reset(n);
+    q.reset(n);
+    weights.reset(n / 2);
+}
+
+
+template<typename Component>
+constexpr
+auto Contracted<Component>::
+element_ind(const EndSlot& s) const noexcept -> szt
+{
+    return 2 * static_cast<szt>(cmp->chain(s.w).idc) + static_cast<szt>(s.e);
+}
+
+
+template<typename Component>
+constexpr
+auto Contracted<Component>::
+element(const szt i) const noexcept -> EndSlot
+{
+    return EndSlot {cmp->chid(i/2), static_cast<Ends::Id>(i % 2)};
+}
+
+
+template<typename Component>
+void Contracted<Component>::
+relax(
+    const szt u,
+    const szt v,
+    const EdgeWeight d,
+    const bool isAcross
+)
+{
+    if (auto& l = labels[v]; d < l.dist) {
+        l = {d, u, isAcross};
+        q.push(v, d);
+    }
+}
+
+
+template<typename Component>
+auto Contracted<Component>::
+weight(const Chain& m) -> EdgeWeight
+{
+    auto& w = weights[static_cast<szt>(m.idc)];
+    if (!(w < inf))
+        w = m.weight();
+
+    return w;
+}
+
+
+template<typename Component>
+auto Contracted<Component>::
+span(
+    const Chain& m,
+    const EgId a1,
+    const EgId a2
+) noexcept -> EdgeWeight
+{
+    EdgeWeight res {};
+    for (auto a = a1; a < a2; ++a)
+        res += m.g[a].weight;
+
+    return res;
+}
+
+
+template<typename Component>
+void Contracted<Component>::
+walk(
+    const Chain& m,
+    const EgId a1,
+    const EgId a2,
+    const bool withFirst,
+    Path& path
+)
+{
+    if (withFirst)
+        path.push_back(m.g[a1].indc);
+
+    if (a1 < a2)
+        for (auto a = a1 + 1; a <= a2; ++a)
+            path.push_back(m.g[a].indc);
+    else
+        for (auto a = a1; a > a2; --a)
+            path.push_back(m.g[a-1].indc);
+}
+
+
+template<typename Component>
+auto Contracted<Component>::
+find_shortest_path(
+    const EgId s1,  // starting edge indc
+    const EgId s2   // final edge indc
+) -> Path
+{
+    reset();
+
+    const auto& m1 = cmp->chain(cmp->gl[s1].w);
+    const auto& m2 = cmp->chain(cmp->gl[s2].w);
+    const auto a1 = cmp->gl[s1].a;
+    const auto a2 = cmp->gl[s2].a;
+
+    // The source chain ends are reached by walking along the source chain:
+    for (const auto e: Ends::Ids) {
+        const auto v = element_ind(EndSlot {m1.idw, e});
+        const auto d = e == Ends::A ? span(m1, 0, a1)
+                                    : span(m1, a1 + 1, m1.length());
+        labels[v].dist = d;
+        q.push(v, d);
+    }
+
+    // The best path found so far; undefined last slot marks the path
+    // lying entirely inside the source chain.
+    auto best = inf;
+    auto last = undefined<szt>;
+    if (m1.idw == m2.idw)
+        best = a1 <= a2 ? span(m1, a1 + 1, a2 + 1)
+                        : span(m1, a2, a1);
+
+    // Distances from the end edges of the target chain to the target edge:
+    const std::array<EdgeWeight, 2> dt2 {span(m2, 1, a2 + 1),
+                                         span(m2, a2, m2.length() - 1)};
+
+    while (!q.empty()) {
+        const auto [d, u] = q.pop();
+
+        if (d >= best)
+            break;
+
+        const auto s = element(u);
+        const auto& m = cmp->chain(s.w);
+
+        if (s.w == m2.idw)
+            if (const auto dt = d + dt2[s.e]; dt < best) {
+                best = dt;
+                last = u;
+            }
+
+        // Along the chain to its opposite end:
+        relax(u, element_ind(s.opp()),
+              d + weight(m) - m.end_edge(s.e).weight, false);
+
+        // Across the vertex at this end:
+        for (const auto& n: m.ngs[s.e]())
+            relax(u, element_ind(n),
+                  d + cmp->chain(n.w).end_edge(n.e).weight, true);
+    }
+
+    Path path;
+
+    if (!(best < inf))
+        return path;
+
+    if (is_undefined(last)) {
+        walk(m1, a1, a2, true, path);
+        return path;
+    }
+
+    std::deque<szt> ss;
+    for (auto u = last; is_defined(u); u = labels[u].prev)
+        ss.push_front(u);
+
+    const auto s0 = element(ss.front());
+    walk(m1, a1, m1.end2a(s0.e), true, path);
+
+    for (szt i {1}; i<ss.size(); ++i) {
+        const auto f = element(ss[i-1]);
+        const auto t = element(ss[i]);
+        const auto& m = cmp->chain(t.w);
+        if (labels[ss[i]].across)
+            path.push_back(m.end_edge(t.e).indc);
+        else
+            walk(m, m.end2a(f.e), m.end2a(t.e), false, path);
+    }
+
+    const auto sl = element(ss.back());
+    walk(m2, m2.end2a(sl.e), a2, false, path);
+
+    return path;
+}
+
+
+}  // namespace graph_mutator::structure::paths::over_edges
+
+#endif  // GRAPH_MUTATOR_STRUCTURE_PATHS_OVER_EDGES_CONTRACTED_H
@@ -29,6 +29,7 @@ limitations under the License.
 
 #include <algorithm>  // remove, ranges::sort
 #include <array>
+#include <deque>
 #include <ranges>
 #include <set>
 #include <string>
@@ -38,6 +39,8 @@ limitations under the License.
 #include "../../../definitions.h"
 #include "../../vertices/collections.h"
 #include "../../vertices/vertex.h"
+#include "../queues.h"
+#include "../workspace.h"
 #include "distance.h"
 
 
@@ -51,6 +54,8 @@ struct Generic {
     using Edge = Chain::Edge;
     using EndSlot = Chain::EndSlot;
     using Ends = Edge::Ends;  ///< Type alias for edge ends.
+    using EdgeWeight = typename Edge::weight_t;
+    using WeightClass = typename Component::WeightClass;
 
     /// Type alias for path over consecutively connected vertexes.
     using Path = std::deque<EgId>;
@@ -60,6 +65,20 @@ struct Generic {
 
     Component const* cmp {};   ///< Pointer to the graph component.
 
+    /**
+     * @brief Storage reused by the computations.
+     * @details Leased from the pool of the current thread, so that
+     * consecutive computations, also over different components, do not
+     * allocate and reset it in time proportional to the edges touched.
+     */
+    struct Workspace {
+        IndexedHeap<EdgeWeight> heap;     ///< Queue for arbitrary weights.
+        BucketQueue<EdgeWeight> buckets;  ///< Queue for small integral weights.
+        StampedArray<Dist> distances;
+        std::vector<EgId> front;          ///< Breadth-first search frontier.
+        std::vector<EgId> next;           ///< Next frontier.
+    };
+
     explicit constexpr Generic(Component const* const cmp) noexcept;
 
     Generic() = default;
@@ -73,9 +92,14 @@ struct Generic {
      * \brief Computes paths connecting a vertex in the graph
      * \details Computes paths starting at vertex \p source to other vertexes
      * in the connected component of the graph;
-     * \note utilizes the component adjacency list of chains.
+     * \note utilizes the cached adjacency list of the component edges.
      * \note Implements Dijkstra's algorithm
      * \ref https://en.wikipedia.org/wiki/Dijkstra%27s_algorithm.
+     * If all the component edges have equal weights, the distances are
+     * obtained by breadth-first search; small integral weights are handled
+     * with a bucket queue, and the other weights with an indexed heap.
+     * The weights are classified once per change of the component: see
+     * Component::weight_class().
      * \param[in] source Path element from which the paths are computed.
      */
     void compute_from_source(EgId source);
@@ -142,14 +166,10 @@ struct Generic {
 
 private:
 
-    using Q = std::set<Dist>;
-    Q q;
-
-    Distances distances;
-
-    decltype(Component::ajlg) ajlg;
+    typename WorkspacePool<Workspace>::Lease ws {
+        WorkspacePool<Workspace>::acquire()
+    };
 
-    void set_agl();
     void reset();
 
     /**
@@ -159,10 +179,15 @@ private:
 
     constexpr auto element(szt i) const noexcept -> EgId;
 
-    void update(
-        const Q::value_type& ud,
-        EgId v
-    );
+    /// Dijkstra's algorithm using priority queue \p q.
+    template<typename Queue>
+    void dijkstra(EgId source, Queue& q);
+
+    /// Breadth-first search over edges of equal weight \p w.
+    void bfs(EgId source, EdgeWeight w);
+
+    /// Classifies the weights of the component edges.
+    auto classify_weights() const -> WeightClass;
 };
 
 
@@ -183,10 +208,9 @@ constexpr
 Generic<Component>::
 Generic(const Generic& all) noexcept
     : cmp {all.cmp}
-    , q {all.q}
-    , distances {all.distances}
-    , ajlg {all.ajlg}
-{}
+{
+    *ws = *all.ws;
+}
 
 
 template<typename Component>
@@ -194,10 +218,10 @@ constexpr
 Generic<Component>::
 Generic(Generic&& all) noexcept
     : cmp {all.cmp}
-    , q {std::move(all.q)}
-    , distances {std::move(all.distances)}
-    , ajlg {std::move(all.ajlg)}
-{}
+{
+    // The source keeps a workspace, so that it remains usable:
+    std::swap(ws, all.ws);
+}
 
 
 template<typename Component>
@@ -206,9 +230,7 @@ auto Generic<Component>::
 operator=(const Generic& all) -> Generic&
 {
     cmp = all.cmp;
-    q = all.q;
-    distances = all.distances;
-    ajlg = all.ajlg;
+    *ws = *all.ws;
     return *this;
 }
 
@@ -219,34 +241,16 @@ auto Generic<Component>::
 operator=(Generic&& all) -> Generic&
 {
     cmp = all.cmp;
-    q = std::move(all.q);
-    distances = std::move(all.distances);
-    ajlg = std::move(all.ajlg);
+    std::swap(ws, all.ws);
     return *this;
 }
 
 
-template<typename Component>
-void Generic<Component>::
-set_agl()
-{
-    ajlg = cmp->adjacency_list_edges();
-    for (szt i {}; i<ajlg.size(); ++i) {
-        auto last = std::unique(ajlg[i].begin(), ajlg[i].end());
-        ajlg[i].erase(last, ajlg[i].end());
-    }
-}
-
-
 template<typename Component>
 void Generic<Component>::
 reset()
 {
-    set_agl();
-
-    distances.clear();
-    distances.resize(cmp->num_edges());
-    q.clear();
+    ws->distances.reset(static_cast<szt>(cmp->num_edges()));
 }
 
 
@@ -269,19 +273,59 @@ element(const szt i) const noexcept -> EgId
 
 
 template<typename Component>
+template<typename Queue>
 void Generic<Component>::
-update(
-    const Q::value_type& ud,
-    const EgId v
+dijkstra(
+    const EgId source,
+    Queue& q
 )
 {
-    const auto d = ud.get_dist() + cmp->edge(v).weight;
-    const auto vi = element_ind(v);
+    const auto& ajlg = cmp->edge_adjacency();
+
+    q.push(element_ind(source), Dist::zero);
 
-    if (d < distances[vi].get_dist()) {
-        q.erase(Dist {v, distances[vi].get_dist()});
-        distances[vi].set(ud.get_prev(), d);
-        q.emplace(v, distances[vi].get_dist());
+    do {
+        const auto [du, ui] = q.pop();
+        const auto u = element(ui);
+
+        // Visit each edge adjacent to u
+        for (const auto v: ajlg[u]) {
+            const auto d = du + cmp->edge(v).weight;
+            const auto vi = element_ind(v);
+            if (d < ws->distances[vi].get_dist()) {
+                ws->distances[vi].set(u, d);
+                q.push(vi, d);
+            }
+        }
+    } while (!q.empty());
+}
+
+
+template<typename Component>
+void Generic<Component>::
+bfs(
+    const EgId source,
+    const EdgeWeight w
+)
+{
+    const auto& ajlg = cmp->edge_adjacency();
+
+    auto& front = ws->front;
+    auto& next = ws->next;
+    front.assign(1, source);
+    next.clear();
+
+    for (auto d = w; !front.empty(); d += w) {
+        for (const auto u: front)
+            for (const auto v: ajlg[u]) {
+                const auto vi = element_ind(v);
+                if (!ws->distances[vi].is_finite()) {
+                    ws->distances[vi].set(u, d);
+                    next.push_back(v);
+                }
+            }
+        std::swap(front, next);
+        next.clear();
     }
 }
 
@@ -292,17 +336,41 @@ compute_from_source(const EgId source)
 {
     reset();
 
-    distances[element_ind(source)].set_dist(Dist::zero);
-    q.emplace(source, Dist::zero);
+    ws->distances[element_ind(source)].set_dist(Dist::zero);
+
+    const auto n = static_cast<szt>(cmp->num_edges());
+    const auto& wc = cmp->weight_class([this] { return classify_weights(); });
+
+    switch (wc.kind) {
+        case WeightClass::equal:
+            bfs(source, wc.maxWeight);
+            break;
+        case WeightClass::smallIntegral:
+            ws->buckets.reset(n, static_cast<szt>(wc.maxWeight));
+            dijkstra(source, ws->buckets);
+            break;
+        default:
+            ws->heap.reset(n);
+            dijkstra(source, ws->heap);
+    }
+}
 
-    do {
-        const auto ud = std::move(*q.begin());
-        q.erase(q.begin());
 
-        // Visit each edge adjacent to u
-        for (const auto nb: ajlg[ud.get_prev()])
-            update(ud, nb);
-    } while (!q.empty());
+template<typename Component>
+auto Generic<Component>::
+classify_weights() const -> WeightClass
+{
+    const auto ww = std::views::iota(EgId {}, cmp->num_edges())
+                  | std::views::transform([this](const EgId i)
+                                          { return cmp->edge(i).weight; });
+
+    if (std::ranges::adjacent_find(ww, std::ranges::not_equal_to {})
+        == std::ranges::end(ww))
+        return {WeightClass::equal, ww.front()};
+
+    return {BucketQueue<EdgeWeight>::accepts(ww) ? WeightClass::smallIntegral
+                                                 : WeightClass::general,
+            std::ranges::max(ww)};
 }
 
 
@@ -317,13 +385,13 @@ find_shortest_path(
     if constexpr (computeFromSource)
         compute_from_source(s1);  // populate distances
 
-    if (distances[element_ind(s2)].is_finite()) {
+    if (ws->distances[element_ind(s2)].is_finite()) {
 
         // The shortest path edge sequence from s1 to s2:
         Path path {s2};
         auto u {s2};
         while(u != s1) {
-            u = distances[element_ind(u)].get_prev();
+            u = ws->distances[element_ind(u)].get_prev();
             path.push_front(u);
         }
 
@@ -374,7 +442,8 @@ distances_to_global_ind() -> const Distances
     // and elements are still indexed as indc
     Distances dg;
 
-    for (const auto p: distances) {
+    for (szt i {}; i<ws->distances.size(); ++i) {
+        const auto p = ws->distances[i];
         if (is_defined(p))
             dg.push_back(cmp->edge(p).ind);
         else
@@ -407,8 +476,8 @@ print_distances(Args... args) const noexcept
          colorcodes::BOLDCYAN, cmp->ind, colorcodes::RESET, ": Distances ",
          args...);
 
-    for (szt i {}; i<distances.size(); ++i)
-        distances[i].print(element(i));
+    for (szt i {}; i<ws->distances.size(); ++i)
+        ws->distances[i].print(element(i));
     log_("");
 }
 
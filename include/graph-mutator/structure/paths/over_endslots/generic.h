@@ -29,15 +29,18 @@ limitations under the License.
 
 #include <algorithm>  // remove, ranges::sort
 #include <array>
+#include <deque>
 #include <ranges>
 #include <set>
 #include <string>
-#include <utility>  // pair
+#include <utility>  // as_const, pair
 #include <vector>
 
 #include "../../../definitions.h"
 #include "../../vertices/collections.h"
 #include "../../vertices/vertex.h"
+#include "../queues.h"
+#include "../workspace.h"
 #include "distance.h"
 
 
@@ -50,6 +53,7 @@ struct Generic {
     using Edge = Chain::Edge;
     using EndSlot = typename Chain::EndSlot;  ///< Type alias for end slot.
     using Ends = Edge::Ends;  ///< Type alias for edge ends.
+    using EdgeWeight = typename Edge::weight_t;
 
     /// Type alias for path over consecutively connected vertexes.
     using Path = std::deque<EndSlot>;
@@ -61,12 +65,53 @@ struct Generic {
 
     const szt numSlots;  // number of end slots in the cluster: 2 * cmp.num_chains()
 
-    explicit constexpr Generic(const Component& cmp) noexcept;
+    /**
+     * @brief Storage reused by the computations.
+     * @details Leased from the pool of the current thread, so that
+     * consecutive computations, also over different components, do not
+     * allocate and reset it in time proportional to the slots touched.
+     */
+    struct Workspace {
+        IndexedHeap<EdgeWeight> q;
+        StampedArray<Dist> distances;
+        StampedArray<unsigned char> sides;
+        std::vector<szt> marked;  ///< Slots marked in \a sides.
+        std::array<std::deque<EndSlot>, 2> qq;
+    };
+
+    explicit Generic(const Component& cmp);
 
     template<bool withChain1>
     auto are_connected(const EndSlot& s1,
                        const EndSlot& s2) -> bool;
 
+    /**
+     * \brief Whether the ends of chain \p s.w are connected bypassing it.
+     * \details Gives the same result as are_connected<false>(s, s.opp()),
+     * but runs a bidirectional breadth-first search over the chain
+     * neighbours from both ends of \p s.w, which stops as soon as the two
+     * searches meet. The side having visited fewer chains is expanded
+     * next. If the ends are not connected, the smaller of the two sides of
+     * the component is thus enumerated in time proportional to its size,
+     * and is available from separated_chains() afterwards. If they are
+     * connected, the searches may have to visit the whole component before
+     * they meet, e.g. around a long cycle.
+     * \param[in] s Chain end slot at which the search starts.
+     */
+    auto is_cycled_over(const EndSlot& s) -> bool;
+
+    /**
+     * \brief Chains of the side cut off by the last is_cycled_over() call.
+     * \details Valid if the call returned false. These are either the
+     * chains reachable from its slot \p s bypassing chain \p s.w, or
+     * the remaining chains of the component including \p s.w, as
+     * indicated by separated_at_source(). Are ordered by chain index.
+     */
+    auto separated_chains() const noexcept -> const ChIds&;
+
+    /// Whether separated_chains() are those reachable from the slot.
+    auto separated_at_source() const noexcept -> bool;
+
 //    template<bool withSourceChain>
 //    void mark_reachable_from_source(const EndSlot& source);
 
@@ -112,13 +157,34 @@ struct Generic {
 
 private:
 
-    using Q = std::set<Dist>;
-    Q q;
+    typename WorkspacePool<Workspace>::Lease ws;
+
+    /// Queue of the chain end slots through which the chains are entered.
+    IndexedHeap<EdgeWeight>& q;
+
+    StampedArray<Dist>& distances;
+
+    /// Sides of the bidirectional search having reached the end slots.
+    StampedArray<unsigned char>& sides;
+
+    /// Numbers of chains reached by either side of the search.
+    std::array<ChId, 2> sideSizes {};
 
-    Distances distances;
+    ChIds separated;           ///< Chains cut off from the component.
+    bool separatedAtSource {}; ///< \a separated are reachable from the slot.
 
     void reset();
 
+    /// Marks slot \p u by \p side unless marked: returns its former mark.
+    auto mark(const EndSlot& u, unsigned char side) -> unsigned char;
+
+    /**
+     * \brief Marks by \p side slots at the vertex of \p v and queues them.
+     * \return True if the vertex was reached by the other side already.
+     */
+    auto reach(const EndSlot& v, unsigned char side,
+               std::deque<EndSlot>& q) -> bool;
+
     /**
      * \brief Computes element indexes of the \a min_distance and \a previous.
      */
@@ -126,9 +192,14 @@ private:
 
     constexpr auto element(szt i) const noexcept -> EndSlot;
 
+    /**
+     * \brief Traverses the chain entered at slot \p u to its opposite end.
+     * \param[in] u Entry slot of the chain.
+     * \param[in] du Distance to \p u.
+     */
     void update(
-        const Q::value_type& ud,
-        const EndSlot& v
+        const EndSlot& u,
+        EdgeWeight du
     );
 };
 
@@ -136,11 +207,14 @@ private:
 // IMPLEMENTATION ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 template<typename Component>
-constexpr
 Generic<Component>::
-Generic(const Component& cmp) noexcept
+Generic(const Component& cmp)
     : cmp {cmp}
     , numSlots {2 * cmp.num_chains()}
+    , ws {WorkspacePool<Workspace>::acquire()}
+    , q {ws->q}
+    , distances {ws->distances}
+    , sides {ws->sides}
 {}
 
 
@@ -170,9 +244,8 @@ template<typename Component>
 void Generic<Component>::
 reset()
 {
-    distances.clear();
-    distances.resize(numSlots);
-    q.clear();
+    distances.reset(numSlots);
+    q.reset(numSlots);
 }
 
 
@@ -193,6 +266,136 @@ are_connected(const EndSlot& s1,
 }
 
 
+template<typename Component>
+auto Generic<Component>::
+reach(
+    const EndSlot& v,
+    const unsigned char side,
+    std::deque<EndSlot>& q
+) -> bool
+{
+    if (const auto former = mark(v, side))
+        return former != side;
+
+    q.push_back(v);
+
+    for (const auto& nb: cmp.chain(v.w).ngs[v.e]()) {
+        if (const auto former = mark(nb, side))
+            return former != side;
+        q.push_back(nb);
+    }
+
+    return false;
+}
+
+
+template<typename Component>
+auto Generic<Component>::
+mark(
+    const EndSlot& u,
+    const unsigned char side
+) -> unsigned char
+{
+    const auto i = element_ind(u);
+    auto& sd = sides[i];
+    if (sd)
+        return sd;
+
+    sd = side;
+    ws->marked.push_back(i);
+
+    // A chain is counted when its first end is reached:
+    if (!std::as_const(sides)[element_ind(u.opp())])
+        ++sideSizes[side - 1];
+
+    return {};
+}
+
+
+template<typename Component>
+auto Generic<Component>::
+is_cycled_over(const EndSlot& s) -> bool
+{
+    constexpr unsigned char fwd {1};
+    constexpr unsigned char bwd {2};
+
+    sides.reset(numSlots);
+    ws->marked.clear();
+    separated.clear();
+    sideSizes = {};
+
+    auto& qq = ws->qq;
+    for (auto& q: qq)
+        q.clear();
+    auto& qf = qq[0];
+    auto& qb = qq[1];
+
+    if (reach(s, fwd, qf) || reach(s.opp(), bwd, qb))
+        return true;
+
+    // Chain s.w is counted by the side of s, but belongs to that of s.opp():
+    --sideSizes[fwd - 1];
+    ++sideSizes[bwd - 1];
+
+    // Advances the search on side 'side' by a single slot:
+    const auto expand = [&](const unsigned char side)
+    {
+        auto& q = qq[side - 1];
+        const auto u = q.front();
+        q.pop_front();
+        return u.w != s.w && reach(u.opp(), side, q);
+    };
+
+    // Expand the side having fewer chains, until it gets exhausted
+    // or meets the other:
+    while (!qf.empty() && !qb.empty())
+        if (expand(sideSizes[0] <= sideSizes[1] ? fwd : bwd))
+            return true;
+
+    auto exhausted = qf.empty() ? fwd : bwd;
+    const auto other = exhausted == fwd ? bwd : fwd;
+
+    // The last expansion may have made the exhausted side the larger one
+    // by a few chains; the sides being disconnected, the other one is
+    // expanded further until it is found either larger or exhausted:
+    auto& qo = qq[other - 1];
+    while (!qo.empty() && sideSizes[other - 1] < sideSizes[exhausted - 1])
+        expand(other);
+    if (qo.empty() && sideSizes[other - 1] < sideSizes[exhausted - 1])
+        exhausted = other;
+
+    // All chains on the exhausted side have been traversed, so both their
+    // ends are marked; s.w belongs to the side of s.opp():
+    separatedAtSource = exhausted == fwd;
+    for (const auto i: ws->marked)
+        if (sides[i] == exhausted && i % 2 == 0)
+            if (const auto w = element(i).w; w != s.w)
+                separated.push_back(w);
+    if (!separatedAtSource)
+        separated.push_back(s.w);
+
+    std::ranges::sort(separated);
+
+    return false;
+}
+
+
+template<typename Component>
+auto Generic<Component>::
+separated_chains() const noexcept -> const ChIds&
+{
+    return separated;
+}
+
+
+template<typename Component>
+auto Generic<Component>::
+separated_at_source() const noexcept -> bool
+{
+    return separatedAtSource;
+}
+
+
 template<typename Component>
 template<bool withSourceChain>
 void Generic<Component>::
@@ -202,45 +405,45 @@ compute_from_source(const EndSlot& s)
 
     distances[element_ind(s)].dist = Dist::zero;
     if constexpr (withSourceChain)
-        q.emplace(s, Dist::zero);
+        q.push(element_ind(s), Dist::zero);
 
     for (const auto& nb: cmp.chain(s.w).ngs[s.e]()) {
         distances[element_ind(nb)].set(s, Dist::zero);
         if (nb.w != s.w)
-            q.emplace(nb, Dist::zero);
+            q.push(element_ind(nb), Dist::zero);
     }
 
-    do {
-        const auto ud = std::move(*q.begin());
-        q.erase(q.begin());
+    while (!q.empty()) {
+        const auto [du, ui] = q.pop();
 
         // Visit the opposite chain end of u
-        update(ud, ud.prev.opp());
-    } while (!q.empty());
+        update(element(ui), du);
+    }
 }
 
 
 template<typename Component>
 void Generic<Component>::
 update(
-    const Q::value_type& ud,
-    const EndSlot& v
+    const EndSlot& u,
+    const EdgeWeight du
 )
 {
-    ASSERT(cmp.chain(ud.prev.w).idw == cmp.chain(v.w).idw,
-           "not the same chain ends: ",
-           cmp.chain(ud.prev.w).idw, " ",  cmp.chain(v.w).idw);
-
-    const auto d = ud.dist + cmp.chain(v.w).weight();
+    const auto v = u.opp();
+    const auto& m = cmp.chain(v.w);
+    const auto d = du + m.weight();
     const auto vi = element_ind(v);
 
     if (d < distances[vi].dist) {
-        distances[vi].set(ud.prev, d);
-        q.emplace(ud.prev, d);
-        for (const auto& nb: cmp.chain(v.w).ngs[v.e]()) {
-            distances[element_ind(nb)].set(v, d);
-            if (nb.w != v.w)
-                q.emplace(nb, d);
+        distances[vi].set(u, d);
+        // Enter the chains connected at the opposite end:
+        for (const auto& nb: m.ngs[v.e]()) {
+            const auto ni = element_ind(nb);
+            if (d < distances[ni].dist) {
+                distances[ni].set(v, d);
+                if (nb.w != v.w)
+                    q.push(ni, d);
+            }
         }
     }
 }
@@ -0,0 +1,400 @@
+/* =============================================================================
+
+Copyright (c) 2021-2025 Valerii Sukhorukov <vsukhorukov@yahoo.com>
+All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+================================================================================
+*/
+
+/**
+ * @file queues.h
+ * @brief Priority queues used by the shortest path computations.
+ * @author Valerii Sukhorukov
+ */
+
+#ifndef GRAPH_MUTATOR_STRUCTURE_PATHS_QUEUES_H
+#define GRAPH_MUTATOR_STRUCTURE_PATHS_QUEUES_H
+
+#include <algorithm>  // min
+#include <cmath>      // floor
+#include <utility>    // pair
+#include <vector>
+
+#include "../../definitions.h"
+
+
+namespace graph_mutator::structure::paths {
+
+/**
+ * @brief Indexed d-ary min-heap of elements 0 ... n-1 prioritized by a key.
+ * @details Positions of the elements inside the heap are tracked, so that
+ * a key of an element already in the heap is decreased in place rather than
+ * by a removal and reinsertion. Elements having equal keys are popped
+ * in the order of their indexes.
+ * @tparam K Type of the key.
+ * @tparam Arity Number of children of a heap node.
+ */
+template<typename K,
+         szt Arity=4>
+class IndexedHeap {
+
+    static_assert(Arity >= 2);
+
+public:
+
+    using Key = K;
+
+    /**
+     * @brief Empties the heap and makes it accept elements 0 ... \p n-1.
+     * @note Takes time proportional to the number of elements left in the
+     * heap, unless the storage has to grow.
+     */
+    void reset(szt n);
+
+    constexpr auto empty() const noexcept -> bool;
+
+    /// Whether the element \p i is currently in the heap.
+    constexpr auto contains(szt i) const noexcept -> bool;
+
+    /**
+     * @brief Inserts element \p i with key \p k or decreases its key to \p k.
+     * @note Larger keys of the elements already in the heap are ignored.
+     */
+    void push(szt i, Key k);
+
+    /// Removes the element having the smallest key: returns {key, element}.
+    auto pop() -> std::pair<Key, szt>;
+
+private:
+
+    std::vector<szt> heap;  ///< Elements in the heap order.
+    std::vector<szt> pos;   ///< Heap positions of the elements.
+    std::vector<Key> keys;  ///< Keys of the elements.
+
+    constexpr auto precedes(szt i, szt j) const noexcept -> bool;
+
+    void place(szt p, szt i) noexcept;
+    void sift_up(szt p) noexcept;
+    void sift_down(szt p) noexcept;
+};
+
+
+/**
+ * @brief Bucket (Dial's) queue of elements 0 ... n-1 for integral keys.
+ * @details Has the interface of IndexedHeap. The keys must be whole numbers,
+ * and those pushed while the queue is not empty must not exceed the last
+ * popped key by more than the maximal weight set in reset(): this holds
+ * for Dijkstra's algorithm over weights not exceeding it. Element and
+ * bucket operations take constant time; a pop scans at most
+ * maxWeight + 1 buckets.
+ * @tparam K Type of the key.
+ */
+template<typename K>
+class BucketQueue {
+
+public:
+
+    using Key = K;
+
+    /// Whether the weights \p ww are suitable for the queue.
+    template<typename Weights>
+    static auto accepts(const Weights& ww) noexcept -> bool;
+
+    /// Maximal edge weight for which the queue is used.
+    static constexpr szt maxWeight {64};
+
+    /**
+     * @brief Empties the queue and makes it accept elements 0 ... \p n-1.
+     * @note Takes time proportional to the number of entries left in the
+     * buckets, unless the storage has to grow.
+     * @param n Number of elements.
+     * @param maxW Maximal weight of the graph edges.
+     */
+    void reset(szt n, szt maxW);
+
+    constexpr auto empty() const noexcept -> bool;
+
+    constexpr auto contains(szt i) const noexcept -> bool;
+
+    /// Inserts element \p i with key \p k or decreases its key to \p k.
+    void push(szt i, Key k);
+
+    /// Removes an element having the smallest key: returns {key, element}.
+    auto pop() -> std::pair<Key, szt>;
+
+private:
+
+    vec2<szt> buckets;      ///< Circular array of buckets.
+    std::vector<Key> keys;  ///< Keys of the elements.
+    std::vector<bool> in;   ///< The element is in the queue.
+    szt cur {};             ///< Key of the current bucket.
+    szt num {};             ///< Number of elements in the queue.
+
+    constexpr auto bucket(szt k) const noexcept -> szt;
+};
+
+
+// IMPLEMENTATION ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+template<typename K,
+         szt Arity>
+void IndexedHeap<K, Arity>::
+reset(const szt n)
+{
+    for (const auto i: heap)
+        pos[i] = undefined<szt>;
+    heap.clear();
+
+    if (pos.size() < n) {
+        pos.resize(n, undefined<szt>);
+        keys.resize(n);
+    }
+}
+
+
+template<typename K,
+         szt Arity>
+constexpr
+auto IndexedHeap<K, Arity>::
+empty() const noexcept -> bool
+{
+    return heap.empty();
+}
+
+
+template<typename K,
+         szt Arity>
+constexpr
+auto IndexedHeap<K, Arity>::
+contains(const szt i) const noexcept -> bool
+{
+    return is_defined(pos[i]);
+}
+
+
+template<typename K,
+         szt Arity>
+constexpr
+auto IndexedHeap<K, Arity>::
+precedes(const szt i, const szt j) const noexcept -> bool
+{
+    return keys[i] < keys[j] || (!(keys[j] < keys[i]) && i < j);
+}
+
+
+template<typename K,
+         szt Arity>
+void IndexedHeap<K, Arity>::
+place(const szt p, const szt i) noexcept
+{
+    heap[p] = i;
+    pos[i] = p;
+}
+
+
+template<typename K,
+         szt Arity>
+void IndexedHeap<K, Arity>::
+sift_up(szt p) noexcept
+{
+    const auto i = heap[p];
+    while (p) {
+        const auto pp = (p - 1) / Arity;
+        if (!precedes(i, heap[pp]))
+            break;
+        place(p, heap[pp]);
+        p = pp;
+    }
+    place(p, i);
+}
+
+
+template<typename K,
+         szt Arity>
+void IndexedHeap<K, Arity>::
+sift_down(szt p) noexcept
+{
+    const auto i = heap[p];
+    const auto n = heap.size();
+    while (true) {
+        const auto c0 = Arity * p + 1;
+        if (c0 >= n)
+            break;
+        auto c = c0;
+        for (auto j = c0 + 1; j < std::min(c0 + Arity, n); ++j)
+            if (precedes(heap[j], heap[c]))
+                c = j;
+        if (!precedes(heap[c], i))
+            break;
+        place(p, heap[c]);
+        p = c;
+    }
+    place(p, i);
+}
+
+
+template<typename K,
+         szt Arity>
+void IndexedHeap<K, Arity>::
+push(const szt i, const Key k)
+{
+    ASSERT(i < pos.size(), "IndexedHeap: element ", i, " is out of range");
+
+    if (contains(i)) {
+        if (!(k < keys[i]))
+            return;
+        keys[i] = k;
+        sift_up(pos[i]);
+        return;
+    }
+
+    keys[i] = k;
+    heap.push_back(i);
+    sift_up(heap.size() - 1);
+}
+
+
+template<typename K,
+         szt Arity>
+auto IndexedHeap<K, Arity>::
+pop() -> std::pair<Key, szt>
+{
+    ASSERT(!empty(), "IndexedHeap: pop from empty heap");
+
+    const auto i = heap.front();
+    pos[i] = undefined<szt>;
+
+    const auto last = heap.back();
+    heap.pop_back();
+    if (!heap.empty()) {
+        heap.front() = last;
+        sift_down(0);
+    }
+
+    return {keys[i], i};
+}
+
+
+template<typename K>
+template<typename Weights>
+auto BucketQueue<K>::
+accepts(const Weights& ww) noexcept -> bool
+{
+    for (const auto w: ww)
+        if (w < zero<Key> ||
+            w > static_cast<Key>(maxWeight) ||
+            std::floor(w) != w)
+            return false;
+
+    return true;
+}
+
+
+template<typename K>
+void BucketQueue<K>::
+reset(const szt n, const szt maxW)
+{
+    ASSERT(maxW <= maxWeight, "BucketQueue: weight ", maxW, " is too large");
+
+    for (auto& b: buckets) {
+        for (const auto i: b)
+            in[i] = false;
+        b.clear();
+    }
+    buckets.resize(maxW + 1);
+
+    if (in.size() < n) {
+        in.resize(n, false);
+        keys.resize(n);
+    }
+    cur = 0;
+    num = 0;
+}
+
+
+template<typename K>
+constexpr
+auto BucketQueue<K>::
+bucket(const szt k) const noexcept -> szt
+{
+    return k % buckets.size();
+}
+
+
+template<typename K>
+constexpr
+auto BucketQueue<K>::
+empty() const noexcept -> bool
+{
+    return !num;
+}
+
+
+template<typename K>
+constexpr
+auto BucketQueue<K>::
+contains(const szt i) const noexcept -> bool
+{
+    return in[i];
+}
+
+
+template<typename K>
+void BucketQueue<K>::
+push(const szt i, const Key k)
+{
+    ASSERT(i < in.size(), "BucketQueue: element ", i, " is out of range");
+
+    if (in[i]) {
+        if (!(k < keys[i]))
+            return;
+    }
+    else {
+        in[i] = true;
+        ++num;
+    }
+
+    // The stale entry of an element in its former bucket is left in place
+    // and skipped when that bucket is scanned.
+    keys[i] = k;
+    buckets[bucket(static_cast<szt>(k))].push_back(i);
+}
+
+
+template<typename K>
+auto BucketQueue<K>::
+pop() -> std::pair<Key, szt>
+{
+    ASSERT(!empty(), "BucketQueue: pop from empty queue");
+
+    while (true) {
+        auto& b = buckets[bucket(cur)];
+        while (!b.empty()) {
+            const auto i = b.back();
+            b.pop_back();
+            if (in[i] && static_cast<szt>(keys[i]) == cur) {
+                in[i] = false;
+                --num;
+                return {keys[i], i};
+            }
+        }
+        ++cur;
+    }
+}
+
+
+}  // namespace graph_mutator::structure::paths
+
+#endif  // GRAPH_MUTATOR_STRUCTURE_PATHS_QUEUES_H
@@ -0,0 +1,210 @@
+/* =============================================================================
+
+Copyright (c) 2021-2025 Valerii Sukhorukov <vsukhorukov@yahoo.com>
+All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+================================================================================
+*/
+
+/**
+ * @file workspace.h
+ * @brief Reusable storage of the path computations.
+ * @author Valerii Sukhorukov
+ */
+
+#ifndef GRAPH_MUTATOR_STRUCTURE_PATHS_WORKSPACE_H
+#define GRAPH_MUTATOR_STRUCTURE_PATHS_WORKSPACE_H
+
+#include <algorithm>  // fill
+#include <memory>
+#include <vector>
+
+#include "../../definitions.h"
+
+
+namespace graph_mutator::structure::paths {
+
+/**
+ * @brief Array of elements 0 ... n-1 which are reset lazily.
+ * @details reset() takes constant time rather than being proportional to the
+ * array size: an element is restored to the initial value on its first
+ * access after the reset, as indicated by the stamp of the last access.
+ * The storage grows to the largest size requested and is never shrunk.
+ * @tparam T Type of the elements.
+ */
+template<typename T>
+class StampedArray {
+
+public:
+
+    explicit StampedArray(T init = T {});
+
+    /// Makes the array hold \p n elements all having the initial value.
+    void reset(szt n);
+
+    constexpr auto size() const noexcept -> szt;
+
+    auto operator[](szt i) noexcept -> T&;
+    auto operator[](szt i) const noexcept -> const T&;
+
+private:
+
+    T init;                         ///< Initial value of the elements.
+    std::vector<T> vals;            ///< Element values.
+    std::vector<unsigned> stamps;   ///< Stamps of the last access.
+    unsigned stamp {};              ///< Stamp of the current reset.
+    szt n {};                       ///< Number of elements.
+};
+
+
+/**
+ * @brief Per-thread pool of reusable workspaces of type \p W.
+ * @details Path computations lease a workspace on construction and return
+ * it to the pool of the calling thread on destruction, so that its storage
+ * is allocated once and reused by the subsequent computations. At most
+ * \a maxSpare workspaces are kept.
+ * @note Leases must not outlive the thread having acquired them.
+ * @tparam W Workspace type.
+ */
+template<typename W>
+class WorkspacePool {
+
+public:
+
+    /// Returns the workspace to the pool.
+    struct Release {
+        void operator()(W* w) const noexcept;
+    };
+
+    using Lease = std::unique_ptr<W, Release>;
+
+    /// Maximal number of spare workspaces kept by a thread.
+    static constexpr szt maxSpare {8};
+
+    /// Takes a spare workspace of the calling thread or makes a new one.
+    static auto acquire() -> Lease;
+
+private:
+
+    static auto spare() -> vup<W>&;
+};
+
+
+// IMPLEMENTATION ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+template<typename T>
+StampedArray<T>::
+StampedArray(T init)
+    : init {std::move(init)}
+{}
+
+
+template<typename T>
+void StampedArray<T>::
+reset(const szt n)
+{
+    this->n = n;
+    if (vals.size() < n) {
+        vals.resize(n);
+        stamps.resize(n);
+    }
+
+    // On a wrap around, the stamps left from earlier resets are cleared:
+    if (!++stamp) {
+        std::fill(stamps.begin(), stamps.end(), 0U);
+        stamp = 1;
+    }
+}
+
+
+template<typename T>
+constexpr
+auto StampedArray<T>::
+size() const noexcept -> szt
+{
+    return n;
+}
+
+
+template<typename T>
+auto StampedArray<T>::
+operator[](const szt i) noexcept -> T&
+{
+    ASSERT(i < n, "StampedArray: element ", i, " is out of range");
+
+    if (stamps[i] != stamp) {
+        stamps[i] = stamp;
+        vals[i] = init;
+    }
+
+    return vals[i];
+}
+
+
+template<typename T>
+auto StampedArray<T>::
+operator[](const szt i) const noexcept -> const T&
+{
+    ASSERT(i < n, "StampedArray: element ", i, " is out of range");
+
+    return stamps[i] == stamp ? vals[i] : init;
+}
+
+
+template<typename W>
+void WorkspacePool<W>::Release::
+operator()(W* const w) const noexcept
+{
+    // The capacity is reserved, so that this does not allocate:
+    if (auto& s = spare(); s.size() < maxSpare)
+        s.emplace_back(w);
+    else
+        delete w;
+}
+
+
+template<typename W>
+auto WorkspacePool<W>::
+acquire() -> Lease
+{
+    auto& s = spare();
+    if (s.empty())
+        return Lease {new W {}};
+
+    auto w = std::move(s.back());
+    s.pop_back();
+
+    return Lease {w.release()};
+}
+
+
+template<typename W>
+auto WorkspacePool<W>::
+spare() -> vup<W>&
+{
+    thread_local auto s = []
+    {
+        vup<W> s;
+        s.reserve(maxSpare);
+        return s;
+    }();
+
+    return s;
+}
+
+
+}  // namespace graph_mutator::structure::paths
+
+#endif  // GRAPH_MUTATOR_STRUCTURE_PATHS_WORKSPACE_H
@@ -28,8 +28,11 @@ limitations under the License.
 #define GRAPH_MUTATOR_STRUCTURE_SLOT_H
 
 #include <array>
+#include <concepts>
+#include <cstdint>
 #include <iostream>
 #include <string>
+#include <type_traits>
 
 #include "../definitions.h"
 #include "ends.h"
@@ -37,6 +40,42 @@ limitations under the License.
 
 namespace graph_mutator::structure {
 
+/**
+ * @brief Index of type \p T stored in 32 bits.
+ * @details Converts implicitly to and from \p T. undefined<T> is mapped to
+ * the largest 32-bit value and back, so that the index compares and prints
+ * as a full-width one.
+ * @tparam T Full-width index type.
+ */
+template<std::unsigned_integral T>
+class PackedId {
+
+public:
+
+    using Word = std::uint32_t;
+
+    constexpr PackedId() noexcept = default;
+
+    constexpr PackedId(const T a) noexcept
+        : v {a == undefined<T> ? undefined<Word> : static_cast<Word>(a)}
+    {
+        ASSERT(a == undefined<T> || a < undefined<Word>,
+               "index ", a, " does not fit in a packed slot");
+    }
+
+    constexpr operator T() const noexcept
+    {
+        return v == undefined<Word> ? undefined<T> : v;
+    }
+
+    constexpr auto word() const noexcept -> Word { return v; }
+
+private:
+
+    Word v {undefined<Word>};
+};
+
+
 /**
  * @brief Template for a slot representing a connection point in a chain.
  * @tparam HostId Type of the host identifier (e.g., ChId).
@@ -55,6 +94,10 @@ struct _Slot {
 
     static constexpr auto isEnd = std::is_same_v<Location, Ends>;
 
+    /// Storage type of the slot fields: full-width or packed.
+    template<typename T>
+    using Field = std::conditional_t<packed_slots, PackedId<T>, T>;
+
     constexpr _Slot() = default;
     constexpr _Slot(const _Slot& s) = default;
     constexpr _Slot(_Slot&& s) = default;
@@ -76,14 +119,27 @@ struct _Slot {
 
     constexpr auto operator==(const _Slot& s) const noexcept -> bool
     {
-        return w == s.w &&
-               e == s.e;
+        if constexpr (packed_slots)
+            return key() == s.key();
+        else
+            return w == s.w &&
+                   e == s.e;
     }
 
     constexpr auto operator<(const _Slot& s) const noexcept -> bool
     {
-        return (w < s.w ||
-               (w == s.w && e < s.e));
+        if constexpr (packed_slots)
+            return key() < s.key();
+        else
+            return (w < s.w ||
+                   (w == s.w && e < s.e));
+    }
+
+    /// Single-word value ordered as the slots; packed mode only.
+    constexpr auto key() const noexcept -> std::uint64_t
+        requires packed_slots
+    {
+        return std::uint64_t {w.word()} << 32 | e.word();
     }
 
     constexpr auto is_defined() const noexcept -> bool
@@ -93,7 +149,7 @@ struct _Slot {
 
     constexpr auto we() const noexcept
     {
-        return std::array {w, e};
+        return std::array<HostId, 2> {w, static_cast<HostId>(e)};
     }
 
     constexpr auto a() const noexcept -> LocId { return e; }
@@ -117,8 +173,11 @@ struct _Slot {
 
     constexpr void write(std::ofstream& ofs) const
     {
-        ofs.write(reinterpret_cast<const char*>(&w), sizeof(w));
-        ofs.write(reinterpret_cast<const char*>(&e), sizeof(e));
+        // The full-width values are written regardless of the packing:
+        const HostId ww {w};
+        const LocId ee {e};
+        ofs.write(reinterpret_cast<const char*>(&ww), sizeof(ww));
+        ofs.write(reinterpret_cast<const char*>(&ee), sizeof(ee));
     }
 
     void print() const
@@ -128,17 +187,17 @@ struct _Slot {
 
     auto str_long() const -> std::string
     {
-        return "w "s + std::to_string(w) +
+        return "w "s + std::to_string(HostId {w}) +
                (isEnd ? " e " : " a ") + ea_str();
     }
 
     auto str_short() const -> std::string
     {
-        return std::to_string(w) + " " + ea_str();
+        return std::to_string(HostId {w}) + " " + ea_str();
     }
 
-    HostId w {undefined<HostId>};
-    LocId  e {undefined<LocId>};
+    Field<HostId> w {undefined<HostId>};
+    Field<LocId>  e {undefined<LocId>};
 };
 
 
@@ -77,7 +77,8 @@ struct All {
     const G& gr;
 
     /// Tuple of vertex collections classified by vertex degree.
-    std::tuple<Collection<0, G>,
+    /// Materialized lazily: see invalidate() and materialize().
+    mutable std::tuple<Collection<0, G>,
                Collection<1, G>,
                Collection<2, G>,
                Collection<3, G>,
@@ -98,6 +99,49 @@ struct All {
     /// Updates all the containers.
     void create() noexcept;
 
+    /**
+     * @brief Marks all the containers for a rebuild on the next access.
+     */
+    void invalidate() noexcept;
+
+    /**
+     * @brief Marks vertices incident to chains \p ww for a refresh on the next
+     * access.
+     * @details Chains accumulate until the vertices are accessed; if they
+     * outnumber the graph chains, a full rebuild is scheduled instead.
+     * @param ww Ids of the chains modified.
+     */
+    void invalidate(const ChIds& ww);
+
+    /**
+     * @brief Brings the containers up to date with the graph if invalidated.
+     * @details Called by the accessors; the containers are otherwise not
+     * touched by the graph transformations. Must not be called inside a
+     * batch of transformations, see Graph::begin_batch().
+     */
+    void materialize() const noexcept;
+
+    /**
+     * @brief Materializes the containers and brings the graph-wide vertex
+     * indexes up to date.
+     * @details The indexes are consecutive over the containers ordered by
+     * degree. A refresh leaves them outdated, because it takes time
+     * proportional to the vertices refreshed only; the slot lookups, num()
+     * and report() do not need them. Called by the accessors exporting the
+     * vertices.
+     */
+    void number() const noexcept;
+
+    /// Checks if the containers are up to date without materializing them.
+    constexpr auto is_current() const noexcept -> bool;
+
+    /**
+     * @brief Updates the containers for vertices incident to chains \p ww only.
+     * @details Vertex indexes are left outdated, see number().
+     * @param ww Sorted ids of the chains modified.
+     */
+    void refresh(const ChIds& ww) noexcept;
+
     void create_on_ends() noexcept;
     void create_on_bulks() noexcept;
 
@@ -138,6 +182,20 @@ struct All {
      * @param ofs File stream to output the data.
      * */
     void to_json(std::ofstream& ofs) const;
+
+private:
+
+    /// The containers need to be rebuilt before the next access.
+    mutable bool outdated {};
+
+    /// The containers need a refresh for the pending chains.
+    mutable bool partial {};
+
+    /// Chains whose incident vertices need a refresh before the next access.
+    mutable ChIds pending;
+
+    /// The vertex indexes need to be reassigned, see number().
+    mutable bool unnumbered {};
 };
 
 
@@ -169,6 +227,108 @@ create() noexcept
 {
     Id ind {};
     std::apply([&](auto&... ns){ (ns.populate(ind), ...); }, all);
+
+    outdated = false;
+    partial = false;
+    unnumbered = false;
+    pending.clear();
+}
+
+
+template<typename G>
+void All<G>::
+refresh(const ChIds& ww) noexcept
+{
+    Id ind {};
+    std::apply([&](auto&... ns){ (ns.refresh(ww, ind), ...); }, all);
+
+    unnumbered = true;
+}
+
+
+template<typename G>
+void All<G>::
+invalidate() noexcept
+{
+    outdated = true;
+    partial = false;
+    pending.clear();
+}
+
+
+template<typename G>
+void All<G>::
+invalidate(const ChIds& ww)
+{
+    if (outdated)
+        return;
+
+    partial = true;
+    pending.insert(pending.end(), ww.begin(), ww.end());
+
+    if (pending.size() > gr.chain_num())
+        invalidate();
+}
+
+
+template<typename G>
+void All<G>::
+materialize() const noexcept
+{
+    // Only the graph runs batches of transformations:
+    if constexpr (requires { gr.batches; }) {
+        ASSERT(!gr.batches || is_current(),
+               "vertices are queried inside a batch of transformations");
+    }
+
+    if (outdated) {
+        Id ind {};
+        std::apply([&](auto&... ns){ (ns.populate(ind), ...); }, all);
+        unnumbered = false;
+    }
+    else if (partial) {
+        std::ranges::sort(pending);
+        const auto [first, last] = std::ranges::unique(pending);
+        pending.erase(first, last);
+
+        Id ind {};
+        std::apply([&](auto&... ns){ (ns.refresh(pending, ind), ...); }, all);
+        unnumbered = true;
+    }
+
+    outdated = false;
+    partial = false;
+    pending.clear();
+}
+
+
+template<typename G>
+void All<G>::
+number() const noexcept
+{
+    materialize();
+
+    if (!unnumbered)
+        return;
+
+    const auto assign = [](auto& ns)
+    {
+        for (Id p {}; p<ns.num(); ++p)
+            ns.vv[p].ind = ns.base + p;
+    };
+
+    std::apply([&](auto&... ns){ (assign(ns), ...); }, all);
+
+    unnumbered = false;
+}
+
+
+template<typename G>
+constexpr
+auto All<G>::
+is_current() const noexcept -> bool
+{
+    return !outdated && !partial;
 }
 
 
@@ -204,6 +364,7 @@ constexpr
 auto All<G>::
 num() const noexcept -> szt
 {
+    materialize();
 
     return std::apply([](const auto&... e){ return (e.num() + ...); }, all);
 }
@@ -215,6 +376,8 @@ constexpr
 auto All<G>::
 num() const noexcept -> szt
 {
+    materialize();
+
     return std::get<D>(all).num();
 }
 
@@ -224,6 +387,8 @@ template<Degree D> requires is_implemented_degree<D>
 auto All<G>::
 for_compartment(const CmpId c) const noexcept -> Collection<D, G>
 {
+    number();
+
     Collection<D, G> vs {gr};
 
     for (const auto& v: std::get<D>(all).vv)
@@ -240,6 +405,7 @@ auto All<G>::
 from_end_slot(const Degree d,
               const G::EndSlot& s) const noexcept -> Id
 {
+    materialize();
 
     switch (d) {
         case 0:
@@ -264,6 +430,8 @@ constexpr
 auto All<G>::
 from_bulk_slot(const G::BulkSlot& s) const noexcept -> Id
 {
+    materialize();
+
     return find_vertex<2, G>(s, std::get<2>(all));
 }
 
@@ -273,6 +441,8 @@ template<Degree D> requires is_implemented_degree<D>
 void All<G>::
 print(const std::string& s) const noexcept
 {
+    number();
+
     log_<false>(s);
     for (const auto& v: std::get<D>(all).vv)
         v.print();
@@ -283,6 +453,8 @@ template<typename G>
 void All<G>::
 print(const std::string& s) const noexcept
 {
+    number();
+
     log_<false>(s);
     if (s.length())
         log_("");
@@ -298,6 +470,8 @@ template<typename G>
 void All<G>::
 report(std::ostream& ofs) const
 {
+    materialize();
+
     ofs << " X ";
     std::apply([&](const auto&... ns){ (ns.report(ofs), ...); },
                all);
@@ -308,6 +482,8 @@ template<typename G>
 void All<G>::
 to_json(std::ofstream& ofs) const
 {
+    number();
+
     const auto nn = num();
 
     auto jsn = [&](const auto& e)
@@ -43,6 +43,172 @@ limitations under the License.
 
 namespace graph_mutator::structure::vertices {
 
+/**
+ * @brief Entries of the lookup table of collection \p ns pointing to vertex
+ * \p v.
+ * @details Vertices at chain ends are stored under Ends::num w + e for each of
+ * their slots, and disconnected cycles under w. Bulk vertices are stored in
+ * the row of their chain under the position a - 1 of the right edge.
+ * @tparam C Vertex collection type.
+ * @param ns Vertex collection.
+ * @param v Vertex of the collection.
+ * @return Pointers to the entries.
+ */
+template<typename C>
+auto lookup_entries(
+    C& ns,
+    const typename C::V& v
+) noexcept
+{
+    if constexpr (C::V::D == Deg0)
+        return std::array<Id*, 1> {&ns.lookup[v.ars[0].w]};
+    else if constexpr (C::V::D == Deg2)
+        return std::array<Id*, 1> {&ns.lookup[v.ars[1].w][v.ars[1].a() - 1]};
+    else {
+        std::array<Id*, C::V::D> ee;
+        for (szt i {}; i<ee.size(); ++i)
+            ee[i] = &ns.lookup[C::Ends::num * v.ars[i].w + v.ars[i].e];
+        return ee;
+    }
+}
+
+/**
+ * @brief Sizes the lookup table of collection \p ns to the graph chains.
+ * @details Entries of the chains present keep their values.
+ * @tparam C Vertex collection type.
+ * @param ns Vertex collection.
+ */
+template<typename C>
+void size_lookup(C& ns) noexcept
+{
+    const auto nw = ns.gr.chain_num();
+
+    if constexpr (C::V::D == Deg0)
+        ns.lookup.resize(nw, undefined<Id>);
+    else if constexpr (C::V::D == Deg2)
+        ns.lookup.resize(nw);
+    else
+        ns.lookup.resize(C::Ends::num * nw, undefined<Id>);
+}
+
+/**
+ * @brief Appends vertex \p v to collection \p ns and to its lookup table.
+ * @tparam C Vertex collection type.
+ * @param ns Vertex collection.
+ * @param v Vertex to append.
+ */
+template<typename C>
+void append(
+    C& ns,
+    typename C::V&& v
+) noexcept
+{
+    ns.vv.push_back(std::move(v));
+    for (const auto e: lookup_entries(ns, ns.vv.back()))
+        *e = ns.vv.size() - 1;
+}
+
+/**
+ * @brief Removes the vertex at position \p p of collection \p ns.
+ * @details The last vertex is moved into its place, so that the removal
+ * takes constant time.
+ * @tparam C Vertex collection type.
+ * @param ns Vertex collection.
+ * @param p Position of the vertex to remove.
+ */
+template<typename C>
+void erase_at(
+    C& ns,
+    const Id p
+) noexcept
+{
+    for (const auto e: lookup_entries(ns, ns.vv[p]))
+        *e = undefined<Id>;
+
+    if (p + 1 < ns.vv.size()) {
+        ns.vv[p] = std::move(ns.vv.back());
+        for (const auto e: lookup_entries(ns, ns.vv[p]))
+            *e = p;
+    }
+    ns.vv.pop_back();
+}
+
+/**
+ * @brief Removes vertices incident to chains \p ww or to chains removed.
+ * @details The vertices are found through the lookup table, which is then
+ * sized to the current graph chains. Takes time proportional to the number
+ * of vertices removed and to the chains removed.
+ * @tparam C Vertex collection type.
+ * @param ns Vertex collection.
+ * @param ww Sorted chain ids.
+ */
+template<typename C>
+void erase_incident(
+    C& ns,
+    const ChIds& ww
+) noexcept
+{
+    const auto nw = ns.gr.chain_num();
+
+    const auto erase = [&](const Id p)
+    {
+        if (is_defined(p))
+            erase_at(ns, p);
+    };
+
+    if constexpr (C::V::D == Deg2) {
+        const auto erase_row = [&](const ChId w)
+        {
+            for (const auto p: ns.lookup[w])
+                erase(p);
+        };
+
+        for (auto w=nw; w<ns.lookup.size(); ++w)
+            erase_row(w);
+        for (const auto w: ww)
+            if (w < ns.lookup.size())
+                erase_row(w);
+
+        size_lookup(ns);
+        for (const auto w: ww)
+            if (w < nw)
+                ns.lookup[w].assign(ns.gr.cn[w].length() ? ns.gr.cn[w].length() - 1
+                                                         : 0,
+                                    undefined<Id>);
+    }
+    else {
+        constexpr szt n = C::V::D == Deg0 ? 1 : C::Ends::num;
+
+        for (auto k=n*nw; k<ns.lookup.size(); ++k)
+            erase(ns.lookup[k]);
+        for (const auto w: ww)
+            for (szt k=n*w; k<n*w+n && k<ns.lookup.size(); ++k)
+                erase(ns.lookup[k]);
+
+        size_lookup(ns);
+    }
+}
+
+/**
+ * @brief Empties collection \p ns and sizes its lookup table to the graph.
+ * @tparam C Vertex collection type.
+ * @param ns Vertex collection.
+ */
+template<typename C>
+void reset_collection(C& ns) noexcept
+{
+    ns.vv.clear();
+    ns.lookup.clear();
+    size_lookup(ns);
+
+    if constexpr (C::V::D == Deg2)
+        for (ChId w {}; w<ns.gr.chain_num(); ++w)
+            ns.lookup[w].assign(ns.gr.cn[w].length() ? ns.gr.cn[w].length() - 1
+                                                     : 0,
+                                undefined<Id>);
+}
+
+
 /**
  * @brief Template for classes updating degree-specific vertex collections.
  * @tparam D Vertex degree.
@@ -75,6 +241,12 @@ struct Collection<0, G> {
 
     Container vv;  ///< Boundary vertices of disconnected cycles.
 
+    /// Positions in vv of the vertices by their slots, see lookup_entries().
+    std::vector<Id> lookup;
+
+    /// Graph-wide index of the first vertex.
+    Id base {};
+
     /// Constructs an Updater from the Graph class instance.
     explicit constexpr Collection(const Graph& gr)
         : gr {gr}
@@ -100,6 +272,18 @@ struct Collection<0, G> {
         Id& indini,
         CmpId c=undefined<CmpId>
     ) noexcept -> Container;
+
+    /**
+     * @brief Refreshes the vertices incident to chains \p ww only.
+     * @details Takes time proportional to the vertices refreshed. The vertex
+     * indexes are left to All::number().
+     * @param ww Sorted ids of the chains modified.
+     * @param index [in, out] Inicial vertex index in the whole_graph count.
+     */
+    void refresh(
+        const ChIds& ww,
+        Id& index
+    ) noexcept;
 };
 
 
@@ -112,17 +296,36 @@ populate(
     const CmpId c
 ) noexcept -> Container
 {
-    vv.clear();
+    reset_collection(*this);
+    base = index;
 
     for (const auto w: gr.chis.cn22)
         if (is_undefined(c) ||
             (is_defined(c) && gr.cn[w].c == c))
-            vv.emplace_back(index++, typename V::ArS{S{w, Ends::A}, S{w, Ends::B}});
+            append(*this, V{index++, typename V::ArS{S{w, Ends::A}, S{w, Ends::B}}});
 
     return vv;
 }
 
 
+template<typename G>
+void Collection<0, G>::
+refresh(
+    const ChIds& ww,
+    Id& index
+) noexcept
+{
+    erase_incident(*this, ww);
+
+    for (const auto w: ww)
+        if (w < gr.chain_num() && gr.cn[w].is_disconnected_cycle())
+            append(*this, V{undefined<Id>, typename V::ArS{S{w, Ends::A}, S{w, Ends::B}}});
+
+    base = index;
+    index += num();
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
@@ -145,6 +348,12 @@ struct Collection<1, G> {
 
     Container vv;   ///< Vertices of degree 1.
 
+    /// Positions in vv of the vertices by their slots, see lookup_entries().
+    std::vector<Id> lookup;
+
+    /// Graph-wide index of the first vertex.
+    Id base {};
+
     /// Constructs an Updater from the Graph class instance.
     explicit constexpr Collection(const Graph& gr)
         : gr {gr}
@@ -170,6 +379,18 @@ struct Collection<1, G> {
         Id& indini,
         CmpId c=undefined<CmpId>
     ) noexcept -> Container;
+
+    /**
+     * @brief Refreshes the vertices incident to chains \p ww only.
+     * @details Takes time proportional to the vertices refreshed. The vertex
+     * indexes are left to All::number().
+     * @param ww Sorted ids of the chains modified.
+     * @param index [in, out] Inicial vertex index in the whole_graph count.
+     */
+    void refresh(
+        const ChIds& ww,
+        Id& index
+    ) noexcept;
 };
 
 
@@ -182,31 +403,53 @@ populate(
     const CmpId c
 ) noexcept -> Container
 {
-    vv.clear();
+    reset_collection(*this);
+    base = indini;
 
     // '11': both ends of the unconnected segments represent distinct vertices
     for (const auto w : gr.chis.cn11)
         if (is_undefined(c) ||
             (is_defined(c) && gr.cn[w].c == c))
             for (const auto e: Ends::Ids)
-                vv.emplace_back(indini++, typename V::ArS{S {w, e}});
+                append(*this, V{indini++, typename V::ArS{S {w, e}}});
 
     // segments '13'
     for (const auto& we: is_defined(c)
                         ? gr.ct[c].chis.cn13
                         : gr.chis.cn13)
-            vv.emplace_back(indini++, typename V::ArS{we});
+            append(*this, V{indini++, typename V::ArS{we}});
 
     // segments '14'
     for (const auto& we: is_defined(c)
                         ? gr.ct[c].chis.cn14
                         : gr.chis.cn14)
-            vv.emplace_back(indini++, typename V::ArS{we});
+            append(*this, V{indini++, typename V::ArS{we}});
 
     return vv;
 }
 
 
+template<typename G>
+void Collection<1, G>::
+refresh(
+    const ChIds& ww,
+    Id& index
+) noexcept
+{
+    erase_incident(*this, ww);
+
+    // every free end of a chain is a vertex of degree 1
+    for (const auto w: ww)
+        if (w < gr.chain_num() && !gr.cn[w].is_vacant())
+            for (const auto e: Ends::Ids)
+                if (!gr.cn[w].ngs[e].num())
+                    append(*this, V{undefined<Id>, typename V::ArS{S {w, e}}});
+
+    base = index;
+    index += num();
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
@@ -228,6 +471,12 @@ struct Collection<2, G> {
 
     Container vv;   ///< Vertices of degree 2.
 
+    /// Positions in vv of the vertices by their slots, see lookup_entries().
+    std::vector<std::vector<Id>> lookup;
+
+    /// Graph-wide index of the first vertex.
+    Id base {};
+
     /// Constructs an Updater from the Graph class instance.
     explicit constexpr Collection(const Graph& gr)
         : gr {gr}
@@ -253,6 +502,18 @@ struct Collection<2, G> {
         Id& indini,
         CmpId c=undefined<CmpId>
     ) noexcept -> Container;
+
+    /**
+     * @brief Refreshes the vertices incident to chains \p ww only.
+     * @details Takes time proportional to the vertices refreshed. The vertex
+     * indexes are left to All::number().
+     * @param ww Sorted ids of the chains modified.
+     * @param index [in, out] Inicial vertex index in the whole_graph count.
+     */
+    void refresh(
+        const ChIds& ww,
+        Id& index
+    ) noexcept;
 };
 
 
@@ -265,7 +526,8 @@ populate(
     const CmpId c
 ) noexcept -> Container
 {
-    vv.clear();
+    reset_collection(*this);
+    base = index;
 
     const auto allcn = [&]()
     {
@@ -277,12 +539,31 @@ populate(
     for (const auto w : is_undefined(c) ? allcn()
                                         : gr.ct[c].ww)
         for (EgId a=1; a<gr.cn[w].length(); ++a)
-            vv.emplace_back(index++, typename V::ArS{S {w, a-1}, S {w, a}});
+            append(*this, V{index++, typename V::ArS{S {w, a-1}, S {w, a}}});
 
     return vv;
 }
 
 
+template<typename G>
+void Collection<2, G>::
+refresh(
+    const ChIds& ww,
+    Id& index
+) noexcept
+{
+    erase_incident(*this, ww);
+
+    for (const auto w: ww)
+        if (w < gr.chain_num())
+            for (EgId a=1; a<gr.cn[w].length(); ++a)
+                append(*this, V{undefined<Id>, typename V::ArS{S {w, a-1}, S {w, a}}});
+
+    base = index;
+    index += num();
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
@@ -305,6 +586,12 @@ struct Collection<3, G> {
 
     Container vv;   ///< Vertices of degree 3.
 
+    /// Positions in vv of the vertices by their slots, see lookup_entries().
+    std::vector<Id> lookup;
+
+    /// Graph-wide index of the first vertex.
+    Id base {};
+
     /// Constructs an Updater from the Graph class instance.
     explicit constexpr Collection(const Graph& gr)
         : gr {gr}
@@ -330,6 +617,18 @@ struct Collection<3, G> {
         Id& indini,
         CmpId c=undefined<CmpId>
     ) noexcept -> Container;
+
+    /**
+     * @brief Refreshes the vertices incident to chains \p ww only.
+     * @details Takes time proportional to the vertices refreshed. The vertex
+     * indexes are left to All::number().
+     * @param ww Sorted ids of the chains modified.
+     * @param index [in, out] Inicial vertex index in the whole_graph count.
+     */
+    void refresh(
+        const ChIds& ww,
+        Id& index
+    ) noexcept;
 };
 
 
@@ -342,20 +641,17 @@ populate(
     const CmpId c
 ) noexcept -> Container
 {
-    vv.clear();
+    reset_collection(*this);
+    base = index;
 
     auto attempt_new_vertex = [&](const S& s)
     {
-        const auto& ng = gr.ngs_at(s);
+        if (is_defined(lookup[Ends::num * s.w + s.e]))
+            return;
 
-        V vertex {index, typename V::ArS{s, ng[0], ng[1]}};
+        const auto& ng = gr.ngs_at(s);
 
-        if (!std::any_of(vv.begin(),
-                         vv.end(),
-                         [&](const auto& nup) { return nup == vertex; })) {
-            vv.push_back(std::move(vertex));
-            ++index;
-        }
+        append(*this, V{index++, typename V::ArS{s, ng[0], ng[1]}});
     };
 
     for (const auto w : is_defined(c) ? gr.ct[c].chis.cn33
@@ -375,6 +671,36 @@ populate(
 }
 
 
+template<typename G>
+void Collection<3, G>::
+refresh(
+    const ChIds& ww,
+    Id& index
+) noexcept
+{
+    erase_incident(*this, ww);
+
+    auto attempt_new_vertex = [&](const S& s)
+    {
+        if (is_defined(lookup[Ends::num * s.w + s.e]))
+            return;
+
+        const auto& ng = gr.ngs_at(s);
+
+        append(*this, V{undefined<Id>, typename V::ArS{s, ng[0], ng[1]}});
+    };
+
+    for (const auto w: ww)
+        if (w < gr.chain_num())
+            for (const auto e: Ends::Ids)
+                if (gr.cn[w].ngs[e].num() == 2)
+                    attempt_new_vertex(S{w, e});
+
+    base = index;
+    index += num();
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
@@ -397,6 +723,12 @@ struct Collection<4, G> {
 
     Container vv;   ///< Vertices of degree 4.
 
+    /// Positions in vv of the vertices by their slots, see lookup_entries().
+    std::vector<Id> lookup;
+
+    /// Graph-wide index of the first vertex.
+    Id base {};
+
     /// Constructs an Updater from the Graph class instance.
     explicit constexpr Collection(const Graph& gr)
         : gr {gr}
@@ -422,6 +754,18 @@ struct Collection<4, G> {
         Id& indini,
         CmpId c=undefined<CmpId>
     ) noexcept -> Container;
+
+    /**
+     * @brief Refreshes the vertices incident to chains \p ww only.
+     * @details Takes time proportional to the vertices refreshed. The vertex
+     * indexes are left to All::number().
+     * @param ww Sorted ids of the chains modified.
+     * @param index [in, out] Inicial vertex index in the whole_graph count.
+     */
+    void refresh(
+        const ChIds& ww,
+        Id& index
+    ) noexcept;
 };
 
 
@@ -434,20 +778,17 @@ populate(
     const CmpId c
 ) noexcept -> Container
 {
-    vv.clear();
+    reset_collection(*this);
+    base = index;
 
     auto attempt_new_vertex = [&](const S& s)
     {
-        const auto& ng = gr.ngs_at(s);
+        if (is_defined(lookup[Ends::num * s.w + s.e]))
+            return;
 
-        V vertex {index, typename V::ArS{s, ng[0], ng[1], ng[2]}};
+        const auto& ng = gr.ngs_at(s);
 
-        if (!std::any_of(vv.begin(),
-                         vv.end(),
-                         [&](const auto& nup) {return nup == vertex;})) {
-            vv.push_back(std::move(vertex));
-            ++index;
-        }
+        append(*this, V{index++, typename V::ArS{s, ng[0], ng[1], ng[2]}});
     };
 
     for (const auto w: is_defined(c) ? gr.ct[c].chis.cn44
@@ -467,6 +808,36 @@ populate(
 }
 
 
+template<typename G>
+void Collection<4, G>::
+refresh(
+    const ChIds& ww,
+    Id& index
+) noexcept
+{
+    erase_incident(*this, ww);
+
+    auto attempt_new_vertex = [&](const S& s)
+    {
+        if (is_defined(lookup[Ends::num * s.w + s.e]))
+            return;
+
+        const auto& ng = gr.ngs_at(s);
+
+        append(*this, V{undefined<Id>, typename V::ArS{s, ng[0], ng[1], ng[2]}});
+    };
+
+    for (const auto w: ww)
+        if (w < gr.chain_num())
+            for (const auto e: Ends::Ids)
+                if (gr.cn[w].ngs[e].num() == 3)
+                    attempt_new_vertex(S{w, e});
+
+    base = index;
+    index += num();
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
@@ -503,6 +874,8 @@ auto for_compartment(
 
 /**
  * @brief Finds a vertex in the collection by its slot.
+ * @details Uses the collection lookup table if present, and a linear search
+ * otherwise.
  * @tparam D Vertex degree.
  * @tparam G Graph class supplying the vertices.
  * @param s Slot of the vertex to find.
@@ -516,12 +889,31 @@ auto find_vertex(
     const Collection<D, G>& ns
 ) noexcept -> Id
 {
+    // Collections filtered by compartment carry no lookup table:
+    if (ns.lookup.empty()) {
+        for (const auto& v: ns.vv)
+            if (v.contains(s))
+                return v.ind;
 
-    for (const auto& v: ns.vv)
-        if (v.contains(s))
-            return v.ind;
+        return undefined<Id>;
+    }
 
-    return undefined<Id>;
+    if constexpr (D == Deg2) {
+        const EgId a = s.a() ? s.a() - 1 : 0;
+
+        return s.w < ns.lookup.size() &&
+               a < ns.lookup[s.w].size() &&
+               is_defined(ns.lookup[s.w][a]) ? ns.base + ns.lookup[s.w][a]
+                                             : undefined<Id>;
+    }
+    else {
+        const szt i = D == Deg0 ? szt {s.w}
+                                : Collection<D, G>::Ends::num * s.w + s.e;
+
+        return i < ns.lookup.size() &&
+               is_defined(ns.lookup[i]) ? ns.base + ns.lookup[i]
+                                        : undefined<Id>;
+    }
 }
 
 /**
@@ -122,26 +122,29 @@ operator()(const CmpId c) noexcept -> Res
                 const auto aLast = gr.gla.back();
                 auto& plast = cn[wLast].g[aLast];
                 plast.ind = p.ind;
+                gr.payloads.move(edgenum-1, p.ind);
                 m.g.pop_back();
                 edgenum--;
                 ct[plast.c].set_edges();
                 ct[plast.c].set_gl();
+                gr.glm[plast.ind] = wLast;
+                gr.gla[plast.ind] = aLast;
             }
             else {
                 m.g.pop_back();
                 edgenum--;
             }
-            gr.make_indma();
+            gr.glm.resize(edgenum);
+            gr.gla.resize(edgenum);
+            gr.payloads.resize(edgenum);
         }
 
-        if (w != gr.ind_last_chain()) {
+        // The chains still to be deleted may be renamed:
+        if (!gr.keep_chain_ids && w != gr.ind_last_chain())
             if (auto ii = std::find(ww.begin(), ww.end(), gr.ind_last_chain());
                 ii != ww.end())
                 *ii = w;
-            gr.rename_chain(gr.ind_last_chain(), w);
-        }
-        cn.pop_back();
-        gr.make_indma();
+        gr.remove_chain(w);
     }
 
     // the last chain in the component was just removed, so ct[c] is empty
@@ -151,7 +154,9 @@ operator()(const CmpId c) noexcept -> Res
         ct[c] = std::move(ct.back());
     }
     ct.pop_back();
-    gr.update();
+
+    // The chains renamed or disconnected above are recorded by the graph:
+    gr.update(ChIds {});
 
     if constexpr (verboseF) {
         log_(
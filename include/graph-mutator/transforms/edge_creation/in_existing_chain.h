@@ -131,13 +131,12 @@ operator()(const S& s) noexcept -> Res
 
     Edge eg {gr.edgenum++};
     const auto ep = m.insert_edge(std::move(eg), a);
-    m.set_g_w();
     gr.ct[m.c].append(m.g[a]);
 
     ASSERT(ep == &m.g[a],
            "unsuccessful edge insert at slot ", s.w, " ", s.ea_str());
 
-    gr.update();
+    gr.update({w});
 
     if constexpr (verboseF) {
         m.print(shortName, "  produces ");
@@ -170,19 +170,25 @@ operator()(const BulkSlot& s) noexcept -> Res
         m.g[a].ind != b.i)
         gr.cn[b.w].g[b.a].indc = m.g[a].indc;
 
+    // chain hosting the edge that takes over index 'ind', if any
+    auto wlast = undefined<ChId>;
     if (ind < gr.edgenum-1) {
         auto& elast = gr.edge(gr.edgenum-1);
         elast.ind = ind;
+        wlast = elast.w;
+        gr.glm[ind] = elast.w;
+        gr.gla[ind] = elast.indw;
         gr.ct[elast.c].set_gl();
+        gr.payloads.move(gr.edgenum-1, ind);
     }
 
     gr.edgenum--;
-    m.g.erase(m.g.begin() + static_cast<long>(a));
-    m.set_g_w();
+    gr.payloads.resize(gr.edgenum);
+    m.remove_edge(a);
 
     gr.ct[c].set_gl();
 
-    gr.update();
+    gr.update({w, wlast});
 
     if constexpr (verboseF) {
         m.print(shortName, " produces");
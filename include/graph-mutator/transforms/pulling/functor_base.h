@@ -96,7 +96,13 @@ private:
 
     void dissolve_single_edge_chain(Ps& pp);
 
-    void shift_edges_to_target_chain(const Ps& pp);
+    /**
+     * @brief Shifts \p n edges across each chain link along the path
+     * towards the driver chain.
+     * @details The component and graph indexes are refreshed once, after
+     * all the links are crossed.
+     */
+    void shift_edges_to_target_chain(const Ps& pp, EgId n=1);
 };
 
 
@@ -123,6 +129,16 @@ pull_free_end(
     int s
 ) -> bool
 {
+    // Unless the source chain is dissolved, consecutive steps only shift
+    // edges along the path, so they are done at once:
+    if (s > 0 && pp.d.w != pp.s.w) {
+        const auto n = static_cast<EgId>(s);
+        if (cn[pp.s.w].length() > n) {
+            shift_edges_to_target_chain(pp, n);
+            return false;
+        }
+    }
+
     bool source_was_dissolved {};
 
     while (s-- > 0) {
@@ -213,7 +229,7 @@ dissolve_single_edge_chain(Ps& pp)
     cn[wN].insert_edge(std::move(eg), a);
     cn[wS].remove_edge(cn[wS].end2a(connectedSlot.e));
     gr.ct[pp.cmp->ind].set_gl();
-    gr.update_books();
+    gr.update_books({wN, wS});
 
     const auto& ns = cn[wS].ngs[connectedSlot.e];
     const auto nnS = ns.num();
@@ -240,7 +256,10 @@ dissolve_single_edge_chain(Ps& pp)
 
 template<typename G>
 void FunctorBase<G>::
-shift_edges_to_target_chain(const Ps& pp)
+shift_edges_to_target_chain(
+    const Ps& pp,
+    const EgId n
+)
 {
     const auto& d = pp.d;
     const auto& pth = pp.pth;
@@ -260,6 +279,7 @@ shift_edges_to_target_chain(const Ps& pp)
     const auto w2 = pp.s.w;
 
     if (w0 != w2) {
+        ChIds ww;
         // rit points to the last element and moves backwards upon incrementing
         auto rit = pth.rbegin();
         const auto rend = pth.rend();
@@ -275,9 +295,12 @@ shift_edges_to_target_chain(const Ps& pp)
                    "leadingInd = ", leadingInd, " and indN = ", indN,
                    " are not ends of connected chains");
 
-            gr.ct[pp.cmp->ind].shift_last_edge(f, t);
-            gr.update_books();
+            gr.ct[pp.cmp->ind].shift_end_edges(f, t, n);
+            ww.push_back(f.w);
+            ww.push_back(t.w);
         }
+        gr.ct[pp.cmp->ind].set_gl();
+        gr.update_books(ww);
     }
 }
 
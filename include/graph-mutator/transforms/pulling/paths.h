@@ -33,6 +33,7 @@ limitations under the License.
 #include "../../definitions.h"
 #include "../../structure/component.h"
 #include "../../structure/slot.h"  // for IndEgInd
+#include "../../structure/paths/over_edges/contracted.h"
 #include "../../structure/paths/over_edges/generic.h"
 #include "../../structure/paths/over_endslots/generic.h"
 #include "common.h"
@@ -51,6 +52,7 @@ struct Paths
     using Ends = Chain::Ends;
     using Edge =  Component::Edge;
     using Base = structure::paths::over_edges::Generic<Component>;
+    using Contracted = structure::paths::over_edges::Contracted<Component>;
     using Path = Base::Path;
     using PathCh = structure::paths::over_endslots::Generic<Component>::Path;
 //    using Skeleton = paths::Container<Driver>;
@@ -355,7 +357,7 @@ set_shortest()
 {
     // driver is at pth.front(),
     // source is at pth.back()
-    pthc = this->template find_shortest_path<true>(
+    pthc = Contracted {cmp}.find_shortest_path(
         cmp->ind2indc(d.ind),
         cmp->chain(s.w).end_edge(s.e).indc
     );
@@ -378,7 +380,7 @@ set_shortest(const Driver& dr,
 
     Path pc;
     if (dr.w != sr.w)
-        pc = b.template find_shortest_path<true>(icD, icS);
+        pc = Contracted {c}.find_shortest_path(icD, icS);
     else {
         const auto w = dr.w;
         const auto aD = b.cmp->gl[icD].a;
@@ -194,26 +194,22 @@ antiparallel(
 
     gr.ct[c2].remove(m2);
 
-    if (end == Ends::A)
-        // Edge::a takes values [1:length()];
+    if (end == Ends::A) {
         // for w1 reverse positions if A-ends are joined;
         m1.reverse_g();
+        m1.insert_edges(std::move(m2.g), m1.length());
+    }
     else
-        // Edge::a takes values [1:length()];
         // for w2 reverse positions if B-ends are joined;
-        m2.reverse_g();
-
-    std::move(m2.g.begin(),
-              m2.g.end(), std::back_inserter(m1.g));
+        // w2 edges are reflected while being appended, so that
+        // w1 edges keep their positions and are not visited
+        m1.append_reversed(std::move(m2.g));
     m2.g.clear();
-    m1.set_g_w();  // because of the edges just inserted
 
-    if (w2 != gr.ind_last_chain())
-        gr.rename_chain(gr.ind_last_chain(), w2);
-    cn.pop_back();
+    gr.remove_chain(w2);
 
     c1 == c2
-        ? gr.ct[c1].set_chis()
+        ? gr.ct[c1].update_chis({w1, w2})
         : gr.merge_components(c1, c2);
 
     // Update internal records:
@@ -224,7 +220,7 @@ antiparallel(
         gr.ct[c2].set_gl();
     }
 
-    gr.update();
+    gr.update({w1, w2});
 
     // Print out summary after the operation.
 
@@ -284,13 +280,10 @@ parallel(
     gr.ct[c1].set_edges();
     gr.ct[c1].set_gl();
 
-    if (w2 != gr.ind_last_chain())
-        gr.rename_chain(gr.ind_last_chain(), w2);
-
-    cn.pop_back();
+    gr.remove_chain(w2);
 
     c1 == c2
-        ? gr.ct[c1].set_chis()
+        ? gr.ct[c1].update_chis({w1, w2})
         : gr.merge_components(c1, c2);
 
     if (c2 < gr.cmpt_num() && c1 != c2) {
@@ -299,7 +292,7 @@ parallel(
     }
     // Update internal records:
 
-    gr.update();
+    gr.update({w1, w2});
 
     // Print out summary after the operation.
 
@@ -337,12 +330,11 @@ to_cycle(const ChId w) noexcept -> std::array<CmpId, 2>
     gr.ngs_at(sA).insert(sB);
     gr.ngs_at(sB).insert(sA);
 
-    gr.ct[cn[w].c].chis.cn11 = undefined<ChId>;
-    gr.ct[cn[w].c].chis.cn22 = w;
+    gr.ct[cn[w].c].update_chis({w});
 
     // Update internal records:
 
-    gr.update();
+    gr.update({w});
 
     // Print out summary after the operation.
 
@@ -153,7 +153,7 @@ operator()(
 
     gr.merge_components(c1, c2);
 
-    gr.update();
+    gr.update({w1, w2});
 
     // Print out summary after the operation.
 
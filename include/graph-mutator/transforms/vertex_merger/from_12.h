@@ -189,14 +189,14 @@ operator()(
     // Update internal records.
 
     cn[w2].c == cn[mi].c
-        ? gr.ct[cn[mi].c].set_chis()
+        ? gr.ct[cn[mi].c].update_chis({w1, w2, mi})
         : gr.merge_components(cn[w2].c, cn[mi].c);
 
     cn[w2].c == cn[w1].c
-        ? gr.ct[cn[w1].c].set_chis()
+        ? gr.ct[cn[w1].c].update_chis({w1, w2, mi})
         : gr.merge_components(cn[w1].c, cn[w2].c);
 
-    gr.update();
+    gr.update({w1, w2, mi});
 
     // Print out summary after the operation.
 
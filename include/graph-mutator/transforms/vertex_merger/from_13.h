@@ -141,10 +141,10 @@ operator()(
     // Update internal records:
 
     c1 == c2
-        ? gr.ct[c1].set_chis()
+        ? gr.ct[c1].update_chis({w1, w2, ngs[0].w, ngs[1].w})
         : gr.merge_components(c1, c2);
 
-    gr.update();
+    gr.update({w1, w2, ngs[0].w, ngs[1].w});
 
     // Print out summary after the operation.
 
@@ -133,7 +133,7 @@ operator()(
     EndSlot s1 {}, s2 {}, s3 {}, s4 {};
 
     if (w1 == w2) {
-        szt aL, aS;
+        EgId aL, aS;
         if (a1 > a2) {
             aL = a1;
             aS = a2;
@@ -280,18 +280,18 @@ operator()(
     const auto [u1, u2, u3, u4] = std::array{s1.w, s2.w, s3.w, s4.w};
 
     cn[u1].c == cn[u2].c
-        ? gr.ct[cn[u2].c].set_chis()
+        ? gr.ct[cn[u2].c].update_chis({u1, u2, u3, u4})
         : gr.merge_components(cn[u1].c, cn[u2].c);
 
     cn[u1].c == cn[u3].c
-        ? gr.ct[cn[u3].c].set_chis()
+        ? gr.ct[cn[u3].c].update_chis({u1, u2, u3, u4})
         : gr.merge_components(cn[u1].c, cn[u3].c);
 
     cn[u1].c == cn[u4].c
-        ? gr.ct[cn[u4].c].set_chis()
+        ? gr.ct[cn[u4].c].update_chis({u1, u2, u3, u4})
         : gr.merge_components(cn[u1].c, cn[u4].c);
 
-    gr.update();
+    gr.update({u1, u2, u3, u4});
 
     // Print out summary after the operation.
 
@@ -173,10 +173,9 @@ disconnected_cycle_d0(const ChId w) -> Res
     for (const auto e : Ends::Ids)
         m.ngs[e].clear();
 
-    gr.ct[m.c].chis.cn11 = w;
-    gr.ct[m.c].chis.cn22 = undefined<ChId>;
+    gr.ct[m.c].update_chis({w});
 
-    gr.update_books();
+    gr.update_books({w});
     if constexpr (Graph::useAgl) {
         gr.update_adjacency_edges(ind1);
         gr.update_adjacency_edges(ind2);
@@ -216,11 +215,11 @@ disconnected_cycle_d2(const BulkSlot& s) -> Res
     const auto ind1 = cn[w].g[a-1].ind;
     const auto ind2 = cn[w].g[a].ind;
 
-    std::move(cn[w].g.begin(),
-              cn[w].g.begin() + static_cast<long>(a),
-              std::back_inserter(cn[w].g));
-    cn[w].g.erase(cn[w].g.begin(),
-                  cn[w].g.begin() + static_cast<long>(a));
+    // Edges before 'a' are moved behind the others; rotating in place
+    // does not read from storage invalidated by the chain growth:
+    std::rotate(cn[w].g.begin(),
+                cn[w].g.begin() + static_cast<long>(a),
+                cn[w].g.end());
 
     cn[w].set_g_w();
     cmp.set_gl();
@@ -228,10 +227,9 @@ disconnected_cycle_d2(const BulkSlot& s) -> Res
     for (const auto e : Ends::Ids)
         cn[w].ngs[e].clear();
 
-    cmp.chis.cn11 = w;
-    cmp.chis.cn22 = undefined<ChId>;
+    cmp.update_chis({w});
 
-    gr.update_books();
+    gr.update_books({w});
     if constexpr (Graph::useAgl) {
         gr.update_adjacency_edges(ind1);
         gr.update_adjacency_edges(ind2);
@@ -281,20 +279,21 @@ linear(const BulkSlot& s) -> Res
     const auto ind2 = cn[w].g[a].ind;
 
     cn.emplace_back(gr.chain_num());    // new chain produced by the split
+    gr.make_indma(gr.ind_last_chain());
 
     auto& n = cn.back();
 
     const auto ss = EndSlot{w, Ends::B};
     const auto isConnected = cn[w].is_connected_at(ss.e);
     bool isCycled {};
-    if (isConnected) {
-        typename Graph::PathsOverEndSlots pp {gr.ct[clini]};
-    // this is true iff there is a connection to s2 via a path outgoing from 's'
-    // knownSize is true: enumertate over the cluster
-        isCycled = pp.template are_connected<false>(ss, ss.opp());
-        if (!isCycled)
-            gr.template split_component<false>(gr.ct[cn[w].c], pp, ss);
-    }
+    if (isConnected)
+        // If not cycled, the side of 'ss' and the rest become
+        // separate components (see Graph::cut_component_at):
+        isCycled = gr.cut_component_at(ss);
+
+    // Component of the chains beyond 'ss' which the new chain joins:
+    const auto cB = isConnected ? cn[gr.ngs_at(ss).front().w].c
+                                : undefined<CmpId>;
 
     std::move(cn[w].g.begin() + static_cast<long>(a),
               cn[w].g.end(),
@@ -314,19 +313,16 @@ linear(const BulkSlot& s) -> Res
     }
     else {
         auto& current = gr.ct[cn[w].c];
-        if (!isCycled) {
-            auto& last = gr.ct.back();
-            n.set_cmpt(last.ind, last.num_chains(), last.num_edges());
-            last.append(n);
-        }
+        if (!isCycled)
+            gr.ct[cB].append(n);
         else
             current.append(n);
         current.set_edges();
         current.set_gl();
-        current.chis.populate(cn, current.ww);
+        current.update_chis({w, n.idw});
     }
 
-    gr.update_books();
+    gr.update_books({w, n.idw});
     if constexpr (Graph::useAgl) {
         gr.update_adjacency_edges(ind1);
         gr.update_adjacency_edges(ind2);
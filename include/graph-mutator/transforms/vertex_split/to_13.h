@@ -123,22 +123,28 @@ operator()(const EndSlot& s) -> Res
 
     const auto& ngs = gr.ngs_at(s);
 
+    // Chains whose end degrees change:
+    ChIds vv {w};
+
     std::array<EgId, I> ind;
     ind[0] = gr.slot2ind(s);
-    for (szt i=1; i<I; ++i)
+    for (szt i=1; i<I; ++i) {
         ind[i] = gr.slot2ind(ngs[i-1]);
+        vv.push_back(ngs[i-1].w);
+    }
 
-    // If not a loop, this forms a new component
-    // from w's end 1 neigs and beyond (excluding w itself):
+    // If not a loop, this forms a new component from w's end 1 neigs
+    // and beyond, or from the smaller side with split_smaller_side:
     const auto isCycle = gr.cut_component_at(s);
 
     gr.remove_slot_from_neigs(s);
 
-    gr.ct[clini].set_chis();
+    // The chains moved by the cut carry their entries along:
+    gr.ct[clini].update_chis(vv);
     if (!isCycle)
-        gr.ct.back().set_chis();
+        gr.ct.back().update_chis(vv);
 
-    gr.update_books();
+    gr.update_books({w});
     if constexpr (Graph::useAgl)
         for (const auto ii: ind)
             gr.update_adjacency_edges(ii);
@@ -128,6 +128,7 @@ operator()(const EndSlot& s) -> Res
     ASSERT(ngs.num() == I - 1,
            shortName, ": input vertex degree ", ngs.num() + 1, " != I ", I);
 
+    const auto w = s.w;
     const auto ng0 = ngs.front();  // copy
 
     const auto ind1 = gr.slot2ind(s);
@@ -140,14 +141,19 @@ operator()(const EndSlot& s) -> Res
         const auto [n0, e0] = ng0.we();
         const auto [n1, e1] = ng1.we();
 
-    // If not a cycle, this forms a new component
-    // from s.w's neigs and beyond (excluding s.w itself).
-        const auto isCycle = gr.cut_component_at(s);
+        // If not a cycle, this forms a new component from s.w's neigs
+        // and beyond, or from the smaller side with split_smaller_side.
+        gr.cut_component_at(s);
 
         gr.remove_slot_from_neigs(s);
         gr.remove_slot_from_neigs(ng0);
 
-        gr.ct[clini].set_chis();
+        // The chains moved by the cut carry their entries along, and
+        // it may have separated w from n0 and n1:
+        const ChIds vv {w, n0, n1};
+        gr.ct[cn[w].c].update_chis(vv);
+        if (cn[n0].c != cn[w].c)
+            gr.ct[cn[n0].c].update_chis(vv);
 
         auto& cmp = gr.ct[cn[ng0.w].c];
         const auto is_cycle1 = cmp.template dfs<true>(ng0, ng1.opp());
@@ -155,9 +161,6 @@ operator()(const EndSlot& s) -> Res
         if (!is_cycle1)
             gr.split_component(cmp, cmp.find_chains(ng1));
 
-        if (!isCycle)
-            gr.ct.back().set_chis();
-
         if (e0 == e1)
             // if e0 is A, g of n0 becomes reversed, else g of n1:
             merge.antiparallel(e0, n0, n1);
@@ -171,6 +174,7 @@ operator()(const EndSlot& s) -> Res
 
         auto& newcmp = gr.ct.emplace_back(gr.cmpt_num(), cn);
         gr.ct[clini].move_to(newcmp, cn[ng0.w]);
+        gr.ct[clini].update_chis({w});
     }
 
 //    gr.update_books();
@@ -178,7 +182,7 @@ operator()(const EndSlot& s) -> Res
 //        gr.update_adjacency_edges(ind1);
 //        gr.update_adjacency_edges(ind2);
 //    }
-    gr.update();
+    gr.update({w, ng0.w});
 
     const auto w1 = gr.glm[ind1];
     const auto w2 = gr.glm[ind2];
@@ -60,6 +60,7 @@ struct VectorContainer {
     constexpr auto size() const noexcept;
     constexpr bool empty() const noexcept;
     constexpr void clear() noexcept;
+    constexpr void reserve(size_type n);
 
     constexpr auto front() noexcept -> reference;
     constexpr auto front() const noexcept -> const_reference;
@@ -128,6 +129,14 @@ clear() noexcept
     return data.clear();
 }
 
+template<typename Type>
+constexpr
+void VectorContainer<Type>::
+reserve(const size_type n)
+{
+    data.reserve(n);
+}
+
 template<typename Type>
 constexpr
 auto VectorContainer<Type>::
@@ -365,6 +365,58 @@ TEST_F(ChainTest, insertEdgeBulk)
 }
 
 
+/// Tests moving a run of edges between two multi-edge chains.
+TEST_F(ChainTest, moveEdgeRun)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests moving a run of edges between "s+
+            "two multi-edge chains");
+
+    constexpr EgId len0 {5};
+    constexpr EgId len1 {3};
+
+    // arbitrary values:
+    // because no graph is available, no consistency is required
+    constexpr ChId idw0 {7};
+    constexpr ChId idw1 {8};
+
+    constexpr EgId ei0 {5};
+    constexpr EgId ei1 {25};
+
+    Chain cn0 {len0, idw0, ei0};
+    Chain cn1 {len1, idw1, ei1};
+
+    // remove g[1] ... g[3] keeping their order
+    constexpr EgId pos {1};
+    constexpr EgId n {3};
+    auto ee = cn0.remove_edges(pos, n);
+
+    ASSERT_EQ(cn0.length(), len0 - n);
+    ASSERT_EQ(ee.size(), n);
+    for (EgId i {}; i<n; ++i)
+        ASSERT_EQ(ee[i].ind, ei0 + pos + i);
+    for (EgId i {}; i<cn0.length(); ++i) {
+        ASSERT_EQ(cn0.g[i].ind, i < pos ? ei0 + i : ei0 + i + n);
+        ASSERT_EQ(cn0.g[i].indw, i);
+    }
+
+    // insert them before the last edge of the other chain
+    constexpr EgId at {len1 - 1};
+    cn1.insert_edges(std::move(ee), at);
+
+    ASSERT_EQ(cn1.length(), len1 + n);
+    for (EgId i {}; i<cn1.length(); ++i) {
+        ASSERT_EQ(cn1.g[i].ind, i < at ? ei1 + i
+                                       : i < at + n ? ei0 + pos + i - at
+                                                    : ei1 + i - n);
+        ASSERT_EQ(cn1.g[i].indw, i);
+        ASSERT_EQ(cn1.g[i].w, idw1);
+    }
+}
+
+
 /// Tests appending an edge to a multi-edge chain.
 TEST_F(ChainTest, appendEdge)
 {
@@ -409,6 +461,106 @@ TEST_F(ChainTest, appendEdge)
 }
 
 
+/// Tests appending edges of another chain in the reverse order.
+TEST_F(ChainTest, appendReversed)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests appending edges of another chain "s+
+            "in the reverse order");
+
+    constexpr EgId len0 {5};
+    constexpr EgId len1 {3};
+
+    // arbitrary values:
+    // because no graph is available, no consistency is required
+    constexpr ChId idw0 {7};
+    constexpr ChId idw1 {8};
+
+    constexpr EgId ei0 {5};
+    constexpr EgId ei1 {25};
+
+    Chain cn0 {len0, idw0, ei0};
+    Chain cn1 {len1, idw1, ei1};
+    const Chain cn1r {cn1};
+    cn1.g[0].reverse();
+
+    cn0.append_reversed(std::move(cn1.g));
+
+    ASSERT_EQ(cn0.length(), len0 + len1);
+    for (EgId i {}; i<cn0.length(); ++i) {
+        ASSERT_EQ(cn0.g[i].indw, i);
+        ASSERT_EQ(cn0.g[i].w, idw0);
+        if (i < len0) {
+            ASSERT_EQ(cn0.g[i].ind, ei0 + i);
+            ASSERT_TRUE(cn0.g[i].points_forwards());
+        }
+        else {
+            const auto j = len0 + len1 - 1 - i;
+            ASSERT_EQ(cn0.g[i].ind, cn1r.g[j].ind);
+            // the edge reversed before appending points forwards again
+            ASSERT_EQ(cn0.g[i].points_forwards(), j == 0);
+        }
+    }
+}
+
+
+/// Tests that the edge primitives keep the bound edge index maps current.
+TEST_F(ChainTest, BoundIndma)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests that the edge primitives keep the bound "s+
+            "edge index maps current");
+
+    constexpr EgId len {5};
+
+    // arbitrary values:
+    // because no graph is available, no consistency is required
+    constexpr ChId idw {7};
+
+    constexpr EgId ei {};
+    constexpr EgId eiE {len};
+
+    Chain cn {len, idw, ei};
+
+    ChIds glm;
+    EgIds gla;
+    cn.bind_indma(glm, gla);
+    ASSERT_TRUE(cn.is_bound_to(glm, gla));
+    cn.set_indma();
+
+    const auto check = [&]
+    {
+        for (EgId i {}; i<cn.length(); ++i) {
+            ASSERT_EQ(glm[cn.g[i].ind], idw);
+            ASSERT_EQ(gla[cn.g[i].ind], i);
+        }
+    };
+
+    check();
+
+    cn.insert_edge(Edge{eiE}, 2);
+    ASSERT_EQ(glm.size(), len + 1);
+    check();
+
+    cn.remove_edge(0);
+    check();
+
+    cn.reverse_g();
+    check();
+
+    // copies are not bound to the maps, moves keep the binding:
+    Chain cp {cn};
+    ASSERT_FALSE(cp.is_bound_to(glm, gla));
+    cp = cn;
+    ASSERT_FALSE(cp.is_bound_to(glm, gla));
+    const Chain mv {std::move(cn)};
+    ASSERT_TRUE(mv.is_bound_to(glm, gla));
+}
+
 /// Tests reverse_g(): reversing orientation of the edges in the chain.
 TEST_F(ChainTest, reverse_g)
 {
@@ -544,6 +696,71 @@ TEST_F(ChainTest, NeigIndexes)
 }
 
 
+/// Tests adding, removing and comparing Neig slots stored in place.
+TEST_F(ChainTest, NeigsInPlace)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests adding, removing and comparing Neig "s +
+            "slots stored in place");
+
+    const EndSlot s1 {1, Ends::A};
+    const EndSlot s2 {2, Ends::B};
+    const EndSlot s3 {3, Ends::A};
+
+    Neigs ngs;
+    ngs.insert(s1);
+    ngs.insert(s2);
+    ngs.insert(s3);
+    ASSERT_EQ(ngs.num(), Neigs::maxNum);
+
+    // the order of the slots is irrelevant for the comparison
+    ASSERT_EQ(ngs, Neigs(s3, s1, s2));
+    ASSERT_NE(ngs, Neigs(s3, s1, s1));
+
+    const auto copy = ngs;
+    ASSERT_TRUE(ngs.remove(s2));
+    ASSERT_EQ(ngs.num(), 2);
+    ASSERT_EQ(ngs[0], s1);
+    ASSERT_EQ(ngs[1], s3);
+    ASSERT_EQ(ngs, Neigs(s3, s1));
+    ASSERT_EQ(copy.num(), Neigs::maxNum);
+    ASSERT_EQ(copy.other_than({s1, s3}).front(), s2);
+
+    ngs.clear();
+    ASSERT_EQ(ngs.num(), 0);
+    ASSERT_FALSE(ngs.has(s1));
+}
+
+
+/// Tests conversions of slot indexes stored in 32 bits.
+TEST_F(ChainTest, PackedId)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests conversions of slot indexes stored in 32 bits");
+
+    using P = structure::PackedId<ChId>;
+
+    static_assert(sizeof(P) == 4);
+
+    ASSERT_EQ(ChId {P {}}, undefined<ChId>);
+    ASSERT_EQ(ChId {P {undefined<ChId>}}, undefined<ChId>);
+    ASSERT_EQ(ChId {P {7}}, 7);
+    ASSERT_EQ(P {undefined<ChId>}.word(), undefined<P::Word>);
+
+    // the ordering of the full-width indexes is kept
+    ASSERT_LT(P {7}.word(), P {8}.word());
+    ASSERT_LT(P {8}.word(), P {undefined<ChId>}.word());
+
+    if constexpr (packed_slots) {
+        ASSERT_EQ(sizeof(EndSlot), 8);
+    }
+}
+
+
 /// Tests predicate checking if the chain is a disconnected cycle.
 TEST_F(ChainTest, IsCycle)
 {
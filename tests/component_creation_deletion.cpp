@@ -24,12 +24,15 @@ limitations under the License.
 
 #include "common.h"
 #include "graph-mutator/definitions.h"
+#include "graph-mutator/structure/edge_payload.h"
 #include "graph-mutator/structure/graph.h"
+#include "graph-mutator/structure/integral_tests.h"
 #include "graph-mutator/transforms/component_creation/functor.h"
 #include "graph-mutator/transforms/component_deletion/functor.h"
 #include "graph-mutator/transforms/vertex_merger/from_11.h"
 #include "graph-mutator/transforms/vertex_merger/from_12.h"
 #include "graph-mutator/transforms/vertex_merger/from_22.h"
+#include "graph-mutator/transforms/vertex_split/to_11.h"
 
 
 namespace graph_mutator::tests::component_creation_deletion {
@@ -297,4 +300,138 @@ TEST_F(DeleteComponentTest, Test1)
 }
 
 
+/// Tests that the per-edge side tables follow component deletions.
+TEST_F(DeleteComponentTest, Payload)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description(
+            "per-edge side tables follow the edge indexes on component deletion"
+        );
+
+    constexpr std::array<EgId, 5> len {3, 4, 5, 2, 6};
+
+    constexpr auto eB = Ends::B;
+
+    G gr;
+
+    for (const auto o : len)
+        gr.add_single_chain_component(o);
+
+    VertexMerger<1, 2, G> merge12 {gr};
+
+    // c1 : w1, w2, w5 over a 3-way junction:
+    merge12(ESlot{1, eB},
+            BSlot{2, 2});
+
+    structure::EdgePayload<szt> pl {gr};
+
+    // The edge weights carry the same tags, as they move with the edges:
+    for (szt k {}; auto& m: gr.cn)
+        for (auto& g: m.g) {
+            pl[g.ind] = k;
+            g.weight = static_cast<real>(k++);
+        }
+
+    DeleteComponent del {gr};
+
+    // Components holding the last edges of the graph, so that the entries
+    // of the edges taking over the freed indexes are moved:
+    for (const CmpId c: {CmpId {0}, CmpId {1}, CmpId {1}}) {
+        del(c);
+        ASSERT_EQ(pl.size(), gr.edgenum);
+        for (const auto& m: gr.cn)
+            for (const auto& g: m.g)
+                ASSERT_EQ(static_cast<real>(pl[g.ind]), g.weight);
+    }
+
+    ASSERT_EQ(gr.cmpt_num(), 1);
+}
+
+
+/// Transformations of a graph keeping the chain indexes stable.
+TEST_F(DeleteComponentTest, StableChainIds)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Transformations of a graph keeping ",
+                          "the chain indexes stable");
+
+    constexpr std::array<EgId, 4> len {4, 3, 5, 2};
+
+    constexpr auto eA = Ends::A;
+    constexpr auto eB = Ends::B;
+
+    G gr;
+    gr.keep_chain_ids = true;
+
+    for (const auto o : len)
+        gr.add_single_chain_component(o);
+
+    const structure::IntegralTests<G> check {gr};
+    check(0);
+
+    // Chains 0 and 1 are merged into 'w', the other one 'v' is vacated:
+    VertexMerger<1, 1, G> merge11 {gr};
+    merge11(ESlot{0, eB}, ESlot{1, eA});
+    check(1);
+
+    ASSERT_EQ(gr.chain_num(), 4);
+    ASSERT_EQ(gr.cmpt_num(), 3);
+    ASSERT_EQ(gr.vacant.size(), 1);
+    const auto v = gr.vacant[0];
+    const ChId w = v ? 0 : 1;
+    ASSERT_TRUE(gr.cn[v].is_vacant());
+    ASSERT_EQ(gr.cn[w].length(), len[0] + len[1]);
+    ASSERT_EQ(gr.cn[2].length(), len[2]);
+    ASSERT_EQ(gr.cn[3].length(), len[3]);
+
+    // 'w' is split at a 3-way junction, the new chain is appended:
+    VertexMerger<1, 2, G> merge12 {gr};
+    merge12(ESlot{2, eA}, BSlot{w, 3});
+    check(2);
+
+    ASSERT_EQ(gr.chain_num(), 5);
+    ASSERT_EQ(gr.cmpt_num(), 2);
+    ASSERT_EQ(gr.vacant, ChIds {v});
+    ASSERT_EQ(gr.cn[w].length() + gr.cn[4].length(), len[0] + len[1]);
+
+    // Chain 3 is split in two, the new chain is appended:
+    vertex_split::To<1, 1, G> split11 {gr};
+    split11(BSlot{3, 1});
+    check(3);
+
+    ASSERT_EQ(gr.chain_num(), 6);
+    ASSERT_EQ(gr.cmpt_num(), 3);
+    ASSERT_EQ(gr.vacant, ChIds {v});
+
+    // The component of chains 'w', 2 and 4 is deleted, its chains are vacated:
+    DeleteComponent<G> delete_comp {gr};
+    delete_comp(gr.cn[w].c);
+    check(4);
+
+    ASSERT_EQ(gr.chain_num(), 6);
+    ASSERT_EQ(gr.cmpt_num(), 2);
+    ASSERT_EQ(gr.edgenum, len[3]);
+    ASSERT_TRUE(std::ranges::is_permutation(gr.vacant, ChIds {0, 1, 2, 4}));
+    ASSERT_EQ(gr.cn[3].length(), 1);
+    ASSERT_EQ(gr.cn[5].length(), 1);
+
+    // A new chain takes a vacant slot:
+    gr.add_single_chain_component(len[0]);
+    check(5);
+
+    ASSERT_EQ(gr.chain_num(), 6);
+    ASSERT_EQ(gr.vacant.size(), 3);
+
+    gr.compact_chains();
+    check(6);
+
+    ASSERT_EQ(gr.chain_num(), 3);
+    ASSERT_TRUE(gr.vacant.empty());
+}
+
+
 }  // namespace graph_mutator::tests::component_creation_deletion
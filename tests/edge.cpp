@@ -81,4 +81,15 @@ TEST(EdgeTest, SetCmp)
 }
 
 
+TEST(EdgeTest, IdWidth)
+{
+    Edge e {3, 4, 5, 6, 7};
+
+    ASSERT_EQ(sizeof(e.ind), narrow_ids ? 4 : sizeof(szt));
+    ASSERT_EQ(sizeof(e.w), sizeof(e.ind));
+    ASSERT_EQ(sizeof(e.c), sizeof(e.ind));
+    ASSERT_EQ(undefined<EgId>, std::numeric_limits<Idx>::max());
+}
+
+
 }  // namespace graph_mutator::tests::edge
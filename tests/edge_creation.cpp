@@ -114,12 +114,15 @@ TEST_F(CreateEdgeTest, LineSingleEdgeExistingChain)
 
     // create edge at the end A of the chain w0
     const auto c0 = create_edge_1(ESlot{w0, Ends::A});
+    ASSERT_TRUE(gr.books_are_current());
 
     // create edge at the end B of the chain w1
     const auto c1 = create_edge_1(ESlot{w1, Ends::B});
+    ASSERT_TRUE(gr.books_are_current());
 
     // create edge at the bulk position a = 1
     const auto c2 = create_edge_2(BSlot{w2, a});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum + 3);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -176,12 +179,15 @@ TEST_F(CreateEdgeTest, LineMultiEdgeExistingChain)
 
     // create edge at the end A of the chain w0
     const auto c0 = create_edge_1(ESlot{w0, Ends::A});
+    ASSERT_TRUE(gr.books_are_current());
 
     // create edge at the end B of the chain w1
     const auto c1 = create_edge_1(ESlot{w1, Ends::B});
+    ASSERT_TRUE(gr.books_are_current());
 
     // create edge at the bulk position a = 1
     const auto c2 = create_edge_2(BSlot{w2, a});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum + 3);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -248,12 +254,15 @@ TEST_F(CreateEdgeTest, CycleExistingChain)
 
     // create edge at the end A of the chain w0
     const auto c0 = create_edge_1(ESlot{w0, Ends::A});
+    ASSERT_TRUE(gr.books_are_current());
 
     // create edge at the end B of the chain w1
     const auto c1 = create_edge_1(ESlot{w1, Ends::B});
+    ASSERT_TRUE(gr.books_are_current());
 
     // create edge at the bulk position a = 1
     const auto c2 = create_edge_2(BSlot{w2, a});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum + 3);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -343,21 +352,27 @@ TEST_F(CreateEdgeTest, CycleLineExistingChain)
 
     // at the end A of the cycle chain w0
     const auto c0 = create_edge_1(ESlot{w0, Ends::A});
+    ASSERT_TRUE(gr.books_are_current());
 
     // at the end A of the linear chain w3
     const auto c1 = create_edge_1(ESlot{w3, Ends::A});
+    ASSERT_TRUE(gr.books_are_current());
 
     // at the end B of the cycle chain w1
     const auto c2 = create_edge_1(ESlot{w1, Ends::B});
+    ASSERT_TRUE(gr.books_are_current());
 
     // at the end B of the linear chain w4
     const auto c3 = create_edge_1(ESlot{w4, Ends::B});
+    ASSERT_TRUE(gr.books_are_current());
 
     // at bulk position a = 2 (which is the end B in this case)
     const auto c4 = create_edge_2(BSlot{w2, a});
+    ASSERT_TRUE(gr.books_are_current());
 
     // at bulk position a = 1 (which is the end B in this case)
     const auto c5 = create_edge_2(BSlot{w5, b});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum + 6);
     ASSERT_EQ(gr.chain_num(), 6);
@@ -426,6 +441,7 @@ TEST_F(CreateEdgeTest, LineNewChain)
 
     // create edge at the bulk position a1
     const auto c0 = create_edge(BSlot{w0, a1});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len + 1);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -458,6 +474,7 @@ TEST_F(CreateEdgeTest, LineNewChain)
 
     // create another edge at the bulk position a2
     const auto c1 = create_edge(BSlot{w0, a2});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len + 2);
     ASSERT_EQ(gr.chain_num(), 5);
@@ -525,6 +542,7 @@ TEST_F(CreateEdgeTest, DiscCycleTrue)
     EdgeCreationNewChain<0, G> create_edge_0 {gr};  // edge creating functor
 
     const auto c0 = create_edge_0(w0);
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len + 1);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -563,6 +581,7 @@ TEST_F(CreateEdgeTest, DiscCycleTrue)
     EdgeCreationNewChain<2, G> create_edge_2 {gr};
 
     const auto c1 = create_edge_2(BSlot{w0, a});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len + 2);
     ASSERT_EQ(gr.chain_num(), 4);
@@ -596,6 +615,7 @@ TEST_F(CreateEdgeTest, DiscCycleTrue)
     EdgeCreationNewChain<3, G> create_edge_3 {gr};
 
     const auto c2 = create_edge_3(ESlot{w0, eA});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len + 3);
     ASSERT_EQ(gr.chain_num(), 5);
@@ -662,6 +682,7 @@ TEST_F(CreateEdgeTest, LineJunctionTrue)
     EdgeCreationNewChain<2, G> create_edge_2 {gr};  // edge creating functor
 
     const auto c0 = create_edge_2(BSlot{w0, a});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len + 1);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -707,6 +728,7 @@ TEST_F(CreateEdgeTest, LineJunctionTrue)
     EdgeCreationNewChain<3, G> create_edge_3 {gr};  // edge creating functor
 
     const auto c1 = create_edge_3(ESlot{w0, eB});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len + 2);
     ASSERT_EQ(gr.chain_num(), 4);
@@ -20,12 +20,14 @@ limitations under the License.
 
 #include <array>
 #include <iostream>
+#include <memory>
 #include <string>
 
 #include "common.h"
 #include "graph-mutator/definitions.h"
 #include "graph-mutator/structure/chain.h"
 #include "graph-mutator/structure/edge.h"
+#include "graph-mutator/structure/edge_payload.h"
 #include "graph-mutator/structure/graph.h"
 #include "graph-mutator/transforms/edge_deletion/deleting_host_chain.h"
 #include "graph-mutator/transforms/edge_deletion/preserving_host_chain.h"
@@ -109,6 +111,7 @@ TEST_F(DeleteEdgeTest, LineFree)
 
     // delete edge at the end A of the chain w0
     const auto c0 = delete_edge_21(BSlot{w0, 0});
+    ASSERT_TRUE(gr.books_are_current());
 
     for (CmpId i {}; i<gr.ct.size(); ++i) {
         const auto& c = gr.ct[i];
@@ -135,6 +138,7 @@ TEST_F(DeleteEdgeTest, LineFree)
 
     // delete edge at the end B of the chain w1
     const auto c1 = delete_edge_21(BSlot{w1, len[1] - 1});
+    ASSERT_TRUE(gr.books_are_current());
 
     for (CmpId i {}; i<gr.ct.size(); ++i) {
         const auto& c = gr.ct[i];
@@ -161,6 +165,7 @@ TEST_F(DeleteEdgeTest, LineFree)
 
     // delete edge inside w2 at position a = 2
     const auto c2 = delete_edge_22(BSlot{w2, a});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum - 3);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -252,6 +257,7 @@ TEST_F(DeleteEdgeTest, Line3wayLines)
 
     // delete edge at the end A of the chain w0
     const auto c0 = delete_edge_21(BSlot{w0, 0});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum - 1);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -305,6 +311,7 @@ TEST_F(DeleteEdgeTest, Line3wayLines)
     // delete edge inside w0
     EdgeDeletion<2, 2, G> delete_edge_22 {gr};
     const auto c1 = delete_edge_22(BSlot{w0, 1});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum - 2);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -359,6 +366,7 @@ TEST_F(DeleteEdgeTest, Line3wayLines)
     // delete edge at the end of w2 connected to the junction
     EdgeDeletion<2, 3, G> delete_edge_23 {gr};
     const auto c2 = delete_edge_23(BSlot{w2, 0});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum - 3);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -412,6 +420,7 @@ TEST_F(DeleteEdgeTest, Line3wayLines)
     // delete the only edge of w1
     EdgeDeletion<1, 3, G> delete_edge_13 {gr};
     const auto c3 = delete_edge_13(ESlot{w1, Ends::B});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum - 4);
     ASSERT_EQ(gr.chain_num(), 1);
@@ -495,6 +504,7 @@ TEST_F(DeleteEdgeTest, LineConnectedToCycle3)
 
     // delete an internal edge of the linear chain
     const auto c0 = delete_edge_22(BSlot{w0, 1});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len - 1);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -555,6 +565,7 @@ TEST_F(DeleteEdgeTest, LineConnectedToCycle3)
     // delete edge the free-end edge of the linear chain
     EdgeDeletion<2, 1, G> delete_edge_21 {gr};
     const auto c1 = delete_edge_21(BSlot{w0, 0});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len - 2);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -615,6 +626,7 @@ TEST_F(DeleteEdgeTest, LineConnectedToCycle3)
     // delete the last edge remaining in the linear chain
     EdgeDeletion<1, 3, G> delete_edge_13 {gr};
     const auto c2 = delete_edge_13(ESlot{w0, Ends::B});
+    ASSERT_TRUE(gr.books_are_current());
 
     // now w0 is a disconnected cycle
     ASSERT_EQ(gr.edgenum, len - 3);
@@ -703,6 +715,7 @@ TEST_F(DeleteEdgeTest, CycleConnectedToLine3)
     // delete an internal edge of the cycle chain
     constexpr EgId b0 {1};
     const auto c0 = delete_edge_22(BSlot{w1, b0});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len - 1);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -764,6 +777,7 @@ TEST_F(DeleteEdgeTest, CycleConnectedToLine3)
     constexpr EgId b1 {};
     EdgeDeletion<2, 3, G> delete_edge_23 {gr};
     const auto c1 = delete_edge_23(BSlot{w1, b1});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len - 2);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -823,6 +837,7 @@ TEST_F(DeleteEdgeTest, CycleConnectedToLine3)
 
     // delete edge at the end A of the cycle chain
     const auto c2 = delete_edge_23(BSlot{w1, gr.cn[w1].length() - 1});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len - 3);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -924,6 +939,7 @@ TEST_F(DeleteEdgeTest, LineConnectedToCycle4)
 
     // delete the last edge of the linear chain w0
     const auto c0 = delete_edge_24(BSlot{w0, gr.cn[w0].length() - 1});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len - 1);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -992,6 +1008,7 @@ TEST_F(DeleteEdgeTest, LineConnectedToCycle4)
 
     // delete the last edge of the cycle chain w2
     const auto c1 = delete_edge_24(BSlot{w2, gr.cn[w2].length() - 1});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len - 2);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -1060,6 +1077,7 @@ TEST_F(DeleteEdgeTest, LineConnectedToCycle4)
 
     // delete the only edge of the linear chain w1: w2 is to become w1
     const auto c2 = delete_edge_14(ESlot{w1, Ends::A});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len - 3);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -1148,6 +1166,7 @@ TEST_F(DeleteEdgeTest, DisconnectedCycle)
 
     // delete an internal edge
     const auto c0 = delete_edge_22(BSlot{w0, 1});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len - 1);
     ASSERT_EQ(gr.chain_num(), 1);
@@ -1201,6 +1220,7 @@ TEST_F(DeleteEdgeTest, DisconnectedCycle)
     // delete edge at end A
     EdgeDeletion<2, 0, G> delete_edge_20 {gr};
     const auto c1 = delete_edge_20(BSlot{w0, 0});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len - 2);
     ASSERT_EQ(gr.chain_num(), 1);
@@ -1253,6 +1273,7 @@ TEST_F(DeleteEdgeTest, DisconnectedCycle)
 
     // delete edge at end B
     const auto c2 = delete_edge_20(BSlot{w0, gr.cn[w0].length() - 1});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len - 3);
     ASSERT_EQ(gr.chain_num(), 1);
@@ -1304,4 +1325,72 @@ TEST_F(DeleteEdgeTest, DisconnectedCycle)
 }
 
 
+/// Tests that the per-edge side tables follow the edge indexes.
+TEST_F(DeleteEdgeTest, Payload)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description(
+            "Tests that the per-edge side tables follow the edge indexes"
+        );
+
+    constexpr std::array<EgId, 3> len {4, 4, 4};
+
+    constexpr ChId w0 {};
+
+    G gr;
+
+    for (const auto o : len)
+        gr.add_single_chain_component(o);
+
+    structure::EdgePayload<szt> pl {gr};
+    ASSERT_EQ(pl.size(), gr.edgenum);
+
+    const auto tag = [](const ChId w, const EgId a) { return 100*w + a; };
+
+    for (const auto& m: gr.cn)
+        for (EgId a {}; a<m.length(); ++a)
+            pl[m.g[a].ind] = tag(m.idw, a);
+
+    EdgeDeletion<2, 1, G> delete_edge_21 {gr};
+
+    // The last edge of the graph takes the index of the deleted one:
+    delete_edge_21(BSlot{w0, 0});
+    ASSERT_TRUE(gr.books_are_current());
+    ASSERT_EQ(pl.size(), gr.edgenum);
+
+    for (const auto& m: gr.cn) {
+        if (m.idw != w0) {
+            for (EgId a {}; a<m.length(); ++a)
+                ASSERT_EQ(pl[m.g[a].ind], tag(m.idw, a));
+        }
+    }
+
+    // Entries of new edges are default values:
+    gr.add_single_chain_component(2);
+    ASSERT_EQ(pl.size(), gr.edgenum);
+    for (const auto& g: gr.cn[gr.ind_last_chain()].g)
+        ASSERT_EQ(pl[g.ind], szt {});
+
+    // The table follows the graph moved into another one:
+    G g1 {std::move(gr)};
+    EdgeDeletion<2, 1, G> delete_edge_21_g1 {g1};
+    delete_edge_21_g1(BSlot{1, 0});
+    ASSERT_TRUE(g1.books_are_current());
+    ASSERT_EQ(pl.size(), g1.edgenum);
+    for (EgId a {}; a<g1.cn[2].length(); ++a)
+        ASSERT_EQ(pl[g1.cn[2].g[a].ind], tag(2, a));
+
+    // A table may outlive its graph, keeping the entries:
+    auto gp = std::make_unique<G>();
+    gp->add_single_chain_component(3);
+    structure::EdgePayload<szt> pl1 {*gp};
+    pl1[2] = 5;
+    gp.reset();
+    ASSERT_EQ(pl1.size(), 3);
+    ASSERT_EQ(pl1[2], 5);
+}
+
+
 }  // namespace graph_mutator::tests::edge_deletion
@@ -18,15 +18,19 @@ limitations under the License.
 ================================================================================
 */
 
+#include <algorithm>
 #include <array>
 #include <iostream>
 #include <string>
+#include <utility>
 
 #include "common.h"
 #include "graph-mutator/structure/chain.h"
 #include "graph-mutator/structure/edge.h"
 #include "graph-mutator/structure/graph.h"
 #include "graph-mutator/structure/vertices/degrees.h"
+#include "graph-mutator/transforms/component_deletion/functor.h"
+#include "graph-mutator/transforms/vertex_merger/from_11.h"
 #include "graph-mutator/transforms/vertex_merger/from_12.h"
 
 
@@ -300,6 +304,331 @@ TEST_F(GraphTest, AddComponent)
 }
 
 
+/// Tests that copies and moves of a graph refer to their own data.
+TEST_F(GraphTest, CopyAndMove)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests that copies and moves of a graph refer to "s+
+                          "their own data");
+
+    constexpr std::array<EgId, 3> len {4, 5, 3};
+
+    G gr;
+    for (const auto u : len)
+        gr.add_single_chain_component(u);
+
+    VertexMerger<1, 2, G> merge12 {gr};
+    merge12(ESlot{0, Ends::B}, BSlot{1, 2});
+
+    const auto refers_to_itself = [](const G& g)
+    {
+        for (const auto& m: g.cn)
+            if (!m.is_bound_to(g.glm, g.gla))
+                return false;
+        for (const auto& c: g.ct)
+            for (const auto w: c.ww)
+                if (&c.chain(w) != &g.cn[w])
+                    return false;
+        return g.books_are_current();
+    };
+
+    const G gr0 {gr};
+    const auto glm0 = gr.glm;
+    const auto gla0 = gr.gla;
+    ASSERT_TRUE(refers_to_itself(gr0));
+
+    // Transforming the original leaves the copy intact:
+    VertexMerger<1, 2, G> merge12a {gr};
+    merge12a(ESlot{3, Ends::B}, BSlot{2, 1});
+    ASSERT_TRUE(refers_to_itself(gr));
+    ASSERT_EQ(gr0.glm, glm0);
+    ASSERT_EQ(gr0.gla, gla0);
+    ASSERT_TRUE(refers_to_itself(gr0));
+
+    G gr1 {std::move(gr)};
+    ASSERT_TRUE(refers_to_itself(gr1));
+
+    G gr2;
+    gr2 = gr0;
+    ASSERT_TRUE(refers_to_itself(gr2));
+
+    gr2 = std::move(gr1);
+    ASSERT_TRUE(refers_to_itself(gr2));
+
+    // The moved graph remains usable:
+    VertexMerger<1, 2, G> merge12b {gr2};
+    merge12b(ESlot{2, Ends::A}, BSlot{4, 1});
+    ASSERT_TRUE(refers_to_itself(gr2));
+}
+
+
+/// Tests constant-time lookups of chains and edges in a component
+TEST_F(GraphTest, ComponentLookups)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests constant-time lookups of chains and edges ",
+                          "in a component");
+
+    constexpr ChId num {3};
+    constexpr EgId len {4};
+
+    G::Chains chains;
+
+    for (ChId i {}; i<num; ++i)
+        chains.emplace_back(len, i, i*len);
+
+    G gr;
+
+    gr.add_component(std::move(chains));
+
+    auto& c = gr.ct.back();
+
+    for (ChId i {}; i<num; ++i) {
+        ASSERT_EQ(c.chid(i), i);
+        ASSERT_TRUE(c.contains_chain(i));
+        for (const auto& g: gr.cn[i].g) {
+            ASSERT_TRUE(c.contains_edge(g.ind));
+            ASSERT_EQ(c.ind2indc(g.ind), g.indc);
+        }
+    }
+    ASSERT_EQ(c.chid(num), undefined<ChId>);
+    ASSERT_FALSE(c.contains_edge(gr.edgenum));
+
+    // The last chain takes over the position of the one removed:
+    c.remove(gr.cn[0]);
+
+    ASSERT_EQ(c.num_chains(), num - 1);
+    ASSERT_EQ(c.num_edges(), (num - 1) * len);
+    ASSERT_EQ(c.ww, (ChIds {2, 1}));
+    ASSERT_EQ(c.chid(0), 2);
+    ASSERT_EQ(c.chid(1), 1);
+    ASSERT_FALSE(c.contains_chain(0));
+
+    for (const auto& g: gr.cn[0].g) {
+        ASSERT_FALSE(c.contains_edge(g.ind));
+        ASSERT_EQ(c.ind2indc(g.ind), undefined<EgId>);
+    }
+    for (const auto w: c.ww)
+        for (const auto& g: gr.cn[w].g) {
+            ASSERT_EQ(c.ind2indc(g.ind), g.indc);
+            ASSERT_EQ(c.gl[g.indc].i, g.ind);
+        }
+}
+
+
+/// Tests that cached adjacency lists of components follow the transformations
+TEST_F(GraphTest, AdjacencyCache)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests that the cached component adjacency lists ",
+                          "follow the graph transformations");
+
+    constexpr std::array<EgId, 2> len {4, 5};
+
+    G gr;
+    for (const auto u : len)
+        gr.add_single_chain_component(u);
+
+    // Rows rebuilt from scratch without the repeated entries:
+    const auto rebuilt = [](const auto& c)
+    {
+        auto a = c.adjacency_list_edges();
+        for (auto& r: a)
+            r.erase(std::unique(r.begin(), r.end()), r.end());
+        return a;
+    };
+
+    const auto is_current = [&]
+    {
+        return std::ranges::all_of(gr.ct, [&](const auto& c)
+            { return c.edge_adjacency() == rebuilt(c); });
+    };
+
+    ASSERT_TRUE(is_current());
+
+    // Unchanged components reuse their lists:
+    const auto* const row = gr.ct[0].edge_adjacency().front().data();
+    ASSERT_EQ(gr.ct[0].edge_adjacency().front().data(), row);
+
+    VertexMerger<1, 2, G> merge12 {gr};
+
+    // Joins the components into a 3-way junction of chains 0, 1 and 2:
+    merge12(ESlot{0, Ends::B}, BSlot{1, 2});
+    ASSERT_TRUE(is_current());
+
+    // Closes a cycle inside the component:
+    merge12(ESlot{0, Ends::A}, BSlot{2, 1});
+    ASSERT_TRUE(is_current());
+
+    const auto& c = gr.ct[gr.cn[0].c];
+    const auto& ajlw = c.chain_adjacency<Orientation::Forwards>();
+    ASSERT_EQ(ajlw, c.adjacency_list_chains<Orientation::Forwards>());
+    ASSERT_EQ(c.chain_adjacency<Orientation::Backwards>(),
+              c.adjacency_list_chains<Orientation::Backwards>());
+
+    // In a cycle of two edges, each edge is both followed and preceded by
+    // the other, which is listed once only:
+    const auto w = gr.chain_num();
+    gr.add_single_chain_component(2);
+    VertexMerger<1, 1, G> merge11 {gr};
+    merge11(ESlot{w, Ends::A}, ESlot{w, Ends::B});
+    ASSERT_TRUE(is_current());
+
+    const auto& ajlg = gr.ct[gr.cn[w].c].edge_adjacency();
+    ASSERT_EQ(ajlg.size(), 2);
+    ASSERT_TRUE(std::ranges::all_of(ajlg, [](const auto& r)
+                                    { return r.size() == 1; }));
+}
+
+
+/// Tests that the derived component data are allocated on first use only
+TEST_F(GraphTest, CompactComponents)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests that the derived component data are ",
+                          "allocated on first use only");
+
+    constexpr CmpId num {100};
+
+    G gr;
+    gr.generate_single_chain_components(num, 3);
+
+    ASSERT_EQ(gr.cmpt_num(), num);
+    ASSERT_TRUE(std::ranges::none_of(gr.ct, [](const auto& c)
+                                     { return c.has_details(); }));
+
+    const auto& c = gr.ct[0];
+    ASSERT_EQ(c.edge_adjacency(), c.adjacency_list_edges());
+    ASSERT_TRUE(c.has_details());
+    ASSERT_FALSE(gr.ct[1].has_details());
+
+    // Copies start without them and rebuild them on access:
+    const G::Cmpt c1 {c};
+    ASSERT_FALSE(c1.has_details());
+    ASSERT_EQ(c1.edge_adjacency(), c.edge_adjacency());
+
+    VertexMerger<1, 2, G> merge12 {gr};
+
+    // Joins components 1 and 2 into a 3-way junction:
+    merge12(ESlot{1, Ends::B}, BSlot{2, 1});
+
+    auto& cj = gr.ct[gr.cn[1].c];
+    ASSERT_EQ(cj.num_chains(), 3);
+    ASSERT_EQ(cj.edge_adjacency(), std::as_const(cj).adjacency_list_edges());
+    ASSERT_EQ(cj.find_chains(ESlot{1, Ends::B}).size(), 3);
+
+    // Searches do not need them:
+    auto& c3 = gr.ct[gr.cn[3].c];
+    ASSERT_EQ(c3.find_chains(ESlot{3, Ends::A}).size(), 1);
+    ASSERT_FALSE(c3.has_details());
+
+    // A component taking a vacant chain slot is not referred to by
+    // the handles to the slot taken before:
+    gr.keep_chain_ids = true;
+    component_deletion::Functor<G> del {gr};
+    del(gr.cn[4].c);
+    ASSERT_EQ(gr.vacant, ChIds {4});
+    const auto h = gr.handle(4);
+    ASSERT_FALSE(gr.is_live(h));
+    gr.add_single_chain_component(3);
+    ASSERT_TRUE(gr.vacant.empty());
+    ASSERT_FALSE(gr.is_live(h));
+    ASSERT_TRUE(gr.is_live(gr.handle(4)));
+    ASSERT_EQ(gr.ct[gr.cn[4].c].find_chains(ESlot{4, Ends::A}).size(), 1);
+}
+
+
+/// Tests that the side separated by the bidirectional search forms a new component
+TEST_F(GraphTest, SplitSmallerSide)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests that the side separated by the ",
+                          "bidirectional search forms a new component");
+
+    constexpr std::array<EgId, 2> len {4, 5};
+
+    G gr;
+    for (const auto u : len)
+        gr.add_single_chain_component(u);
+
+    VertexMerger<1, 2, G> merge12 {gr};
+
+    // Joins the components into a 3-way junction of chains 0, 1 and 2:
+    merge12(ESlot{0, Ends::B}, BSlot{1, 2});
+    ASSERT_EQ(gr.cmpt_num(), 1);
+
+    const ESlot s {0, Ends::B};
+    G::PathsOverEndSlots pp {gr.ct[gr.cn[s.w].c]};
+
+    // Only chain 0 lies behind the junction:
+    ASSERT_FALSE(pp.is_cycled_over(s));
+    ASSERT_FALSE(pp.separated_at_source());
+    ASSERT_EQ(pp.separated_chains(), ChIds {0});
+
+    gr.split_component(gr.ct[gr.cn[s.w].c], ChIds {pp.separated_chains()});
+
+    ASSERT_EQ(gr.cmpt_num(), 2);
+    ASSERT_EQ(gr.cn[0].c, 1);
+    ASSERT_EQ(gr.cn[1].c, 0);
+    ASSERT_EQ(gr.cn[2].c, 0);
+    ASSERT_EQ(gr.ct[0].num_edges(), len[1]);
+    ASSERT_EQ(gr.ct[1].num_edges(), len[0]);
+
+    for (const auto& c: gr.ct) {
+        for (szt i {}; i < c.ww.size(); ++i)
+            ASSERT_EQ(gr.cn[c.ww[i]].idc, i);
+        for (szt i {}; i < c.gl.size(); ++i) {
+            const auto& g = gr.cn[c.gl[i].w].g[c.gl[i].a];
+            ASSERT_EQ(g.indc, i);
+            ASSERT_EQ(g.c, c.ind);
+        }
+    }
+}
+
+
+TEST_F(GraphTest, FindChains)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests that the chains found by the search ",
+                          "are the same in the copied and viewed results");
+
+    constexpr std::array<EgId, 2> len {4, 5};
+
+    G gr;
+    for (const auto u : len)
+        gr.add_single_chain_component(u);
+
+    VertexMerger<1, 2, G> merge12 {gr};
+
+    // Joins the components into a 3-way junction of chains 0, 1 and 2:
+    merge12(ESlot{0, Ends::B}, BSlot{1, 2});
+
+    auto& c = gr.ct[gr.cn[0].c];
+    for (const auto w: ChIds {c.ww})
+        for (const auto e: Ends::Ids) {
+            const ESlot s {w, e};
+            const auto vv = c.find_chains(s);
+            const auto view = c.find_chains_view(s);
+            const ChIds ww (view.begin(), view.end());
+            ASSERT_TRUE(std::ranges::is_permutation(vv, ww));
+        }
+
+    ASSERT_EQ(c.find_chains(ESlot{0, Ends::B}), (ChIds {1, 2, 0}));
+}
+
+
 /// Tests rename_chain(from, to): chain indexes are updated so that the chain
 /// indexed as source will acquire the identity of the target
 TEST_F(GraphTest, RenameChain)
@@ -18,9 +18,12 @@ limitations under the License.
 ================================================================================
 */
 
+#include <algorithm>
 #include <array>
+#include <functional>
 #include <iostream>
 #include <string>
+#include <utility>
 
 #include "common.h"
 #include "graph-mutator/structure/chain.h"
@@ -28,7 +31,9 @@ limitations under the License.
 #include "graph-mutator/structure/graph.h"
 #include "graph-mutator/structure/vertices/degrees.h"
 #include "graph-mutator/structure/paths/over_endslots/generic.h"
+#include "graph-mutator/structure/paths/over_edges/contracted.h"
 #include "graph-mutator/structure/paths/over_edges/generic.h"
+#include "graph-mutator/structure/paths/workspace.h"
 #include "graph-mutator/transforms/vertex_merger/from_11.h"
 #include "graph-mutator/transforms/vertex_merger/from_12.h"
 #include "graph-mutator/transforms/vertex_merger/from_22.h"
@@ -215,6 +220,41 @@ TEST_F(PathTest, OverEndSlots)
 }
 
 
+TEST_F(PathTest, CycledOver)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description(
+            "the bidirectional connectivity query agrees with ",
+            "the full search over chain end slots"
+        );
+
+    const auto gr = create_graph();
+
+    for (const auto& c: gr.ct) {
+        structure::paths::over_endslots::Generic<G::Cmpt> pp {c};
+        structure::paths::over_endslots::Generic<G::Cmpt> pq {c};
+        for (const auto w: c.ww)
+            for (const auto e: Ends::Ids) {
+                const ESlot s {w, e};
+                const auto is_cycle = pp.is_cycled_over(s);
+                ASSERT_EQ(is_cycle,
+                          pq.template are_connected<false>(s, s.opp()));
+                if (is_cycle)
+                    continue;
+                // The smaller side is the one reported:
+                const auto [acc, blk] =
+                    pq.template classify_chains_by_connectivity<false>(s);
+                auto sep = pp.separated_at_source() ? acc : blk;
+                std::ranges::sort(sep);
+                ASSERT_EQ(pp.separated_chains(), sep);
+                ASSERT_EQ(sep.size(), std::min(acc.size(), blk.size()));
+            }
+    }
+}
+
+
 TEST_F(PathTest, OverEdgeInds)
 {
     ++testCount;
@@ -244,6 +284,223 @@ TEST_F(PathTest, OverEdgeInds)
 //    }
 }
 
+
+TEST_F(PathTest, OverEdgeIndsContracted)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description(
+            "the shortest paths computed over chain ends ",
+            "match those computed over edges"
+        );
+
+    // Weight of a path: that of its edges except the first one.
+    const auto weight = [](const G::Cmpt& c, const auto& path)
+    {
+        real res {};
+        for (szt i {1}; i<path.size(); ++i)
+            res += c.edge(path[i]).weight;
+        return res;
+    };
+
+    const auto compare = [&](const G& gr)
+    {
+        for (const auto& c: gr.ct) {
+            structure::paths::over_edges::Generic<G::Cmpt> pp {&c};
+            structure::paths::over_edges::Contracted<G::Cmpt> cp {&c};
+            const auto ajlg = c.adjacency_list_edges();
+            for (EgId e1 {}; e1 < c.num_edges(); ++e1) {
+                pp.compute_from_source(e1);
+                for (EgId e2 {}; e2 < c.num_edges(); ++e2) {
+                    const auto path = cp.find_shortest_path(e1, e2);
+                    const auto expected =
+                        pp.template find_shortest_path<false>(e1, e2);
+
+                    // Equally short alternatives, e.g. around a cycle,
+                    // may differ:
+                    ASSERT_EQ(weight(c, path), weight(c, expected));
+                    ASSERT_EQ(path.front(), e1);
+                    ASSERT_EQ(path.back(), e2);
+
+                    // Consecutive edges of the path are adjacent:
+                    for (szt i {1}; i<path.size(); ++i)
+                        ASSERT_NE(std::ranges::find(ajlg[path[i-1]], path[i]),
+                                  ajlg[path[i-1]].end());
+                }
+            }
+        }
+    };
+
+    const auto gr = create_graph();
+    compare(gr);
+
+    // Edges of unequal weights, for which the shortest path is not the one
+    // having the fewest edges:
+    auto gw = create_graph();
+    for (auto& m: gw.cn)
+        for (auto& g: m.g)
+            g.weight = static_cast<real>(1 + g.ind % 3);
+    compare(gw);
+
+    // A unique shortest path is reproduced exactly:
+    const auto& c = gr.ct[8];
+    structure::paths::over_edges::Generic<G::Cmpt> pp {&c};
+    structure::paths::over_edges::Contracted<G::Cmpt> cp {&c};
+    ASSERT_EQ(cp.find_shortest_path(0, 3),
+              pp.template find_shortest_path<true>(0, 3));
+}
+
+
+TEST_F(PathTest, Queues)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description(
+            "the indexed heap and the bucket queue pop elements ",
+            "in the order of their keys after key decreases"
+        );
+
+    const std::array<real, 6> kk {5., 3., 7., 3., 1., 2.};
+
+    structure::paths::IndexedHeap<real> heap;
+    structure::paths::BucketQueue<real> buckets;
+    heap.reset(kk.size());
+    buckets.reset(kk.size(), 7);
+
+    for (szt i {}; i<kk.size(); ++i) {
+        heap.push(i, kk[i]);
+        buckets.push(i, kk[i]);
+    }
+    heap.push(2, 0.);     // decreased
+    buckets.push(2, 0.);
+    heap.push(4, 6.);     // ignored
+    buckets.push(4, 6.);
+    ASSERT_TRUE(heap.contains(2) && buckets.contains(2));
+
+    // Ties are popped by the heap in the order of element indexes:
+    const std::array<szt, 6> order {2, 4, 5, 1, 3, 0};
+    const std::array<real, 6> keys {0., 1., 2., 3., 3., 5.};
+    for (szt j {}; j<order.size(); ++j) {
+        ASSERT_EQ(heap.pop(), std::make_pair(keys[j], order[j]));
+        ASSERT_EQ(buckets.pop().first, keys[j]);
+    }
+    ASSERT_TRUE(heap.empty() && buckets.empty());
+    ASSERT_FALSE(heap.contains(2) || buckets.contains(2));
+
+    ASSERT_TRUE(structure::paths::BucketQueue<real>::accepts(kk));
+    ASSERT_FALSE(structure::paths::BucketQueue<real>::accepts(
+        std::array<real, 2> {1., 0.5}));
+}
+
+
+TEST_F(PathTest, Workspace)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description(
+            "the reused path storage is restored by the resets ",
+            "and the workspaces are returned to the pool"
+        );
+
+    structure::paths::StampedArray<real> aa {-1.};
+    aa.reset(3);
+    aa[1] = 2.;
+    ASSERT_EQ(std::as_const(aa)[1], 2.);
+    ASSERT_EQ(std::as_const(aa)[2], -1.);
+    aa.reset(5);
+    ASSERT_EQ(aa.size(), 5);
+    ASSERT_EQ(aa[1], -1.);
+    ASSERT_EQ(aa[4], -1.);
+
+    // Elements left in the queues are dropped by the resets:
+    structure::paths::IndexedHeap<real> heap;
+    structure::paths::BucketQueue<real> buckets;
+    heap.reset(3);
+    buckets.reset(3, 2);
+    for (szt i {}; i<3; ++i) {
+        heap.push(i, static_cast<real>(i));
+        buckets.push(i, static_cast<real>(i));
+    }
+    heap.pop();
+    buckets.pop();
+    heap.reset(4);
+    buckets.reset(4, 2);
+    ASSERT_TRUE(heap.empty() && buckets.empty());
+    ASSERT_FALSE(heap.contains(2) || buckets.contains(2));
+    heap.push(3, 1.);
+    buckets.push(3, 1.);
+    ASSERT_EQ(heap.pop(), std::make_pair(real {1.}, szt {3}));
+    ASSERT_EQ(buckets.pop(), std::make_pair(real {1.}, szt {3}));
+
+    using Pool = structure::paths::WorkspacePool<std::vector<int>>;
+    const auto* w = Pool::acquire().get();  // returned at once
+    ASSERT_EQ(Pool::acquire().get(), w);
+}
+
+
+TEST_F(PathTest, OverEdgeWeights)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description(
+            "the shortest path lengths over edges are exact for uniform, ",
+            "small integral and fractional edge weights"
+        );
+
+    auto gr = create_graph();
+    const auto& c = gr.ct[8];
+    const auto ajlg = c.adjacency_list_edges();
+    const auto n = c.num_edges();
+
+    const std::array<std::function<real(EgId)>, 3> weights {
+        [](const EgId) { return 2.; },
+        [](const EgId i) { return static_cast<real>(1 + i % 3); },
+        [](const EgId i) { return 0.5 + 0.25 * static_cast<real>(i % 5); }
+    };
+
+    using WeightClass = G::Cmpt::WeightClass;
+    constexpr std::array<WeightClass::Kind, 3> kinds {
+        WeightClass::equal, WeightClass::smallIntegral, WeightClass::general
+    };
+
+    for (szt j {}; const auto& weight: weights) {
+        for (EgId i {}; i<n; ++i)
+            gr.cn[c.gl[i].w].g[c.gl[i].a].weight = weight(i);
+        gr.ct[8].invalidate_weights();
+
+        structure::paths::over_edges::Generic<G::Cmpt> pp {&c};
+        for (EgId s {}; s<n; ++s) {
+            // Reference distances by Bellman-Ford relaxation:
+            std::vector<real> dd(n, Edge::maxWeight);
+            dd[s] = 0.;
+            for (EgId k {}; k<n; ++k)
+                for (EgId u {}; u<n; ++u)
+                    if (dd[u] < Edge::maxWeight)
+                        for (const auto v: ajlg[u])
+                            dd[v] = std::min(dd[v], dd[u] + weight(v));
+
+            pp.compute_from_source(s);
+            for (EgId t {}; t<n; ++t) {
+                const auto path = pp.template find_shortest_path<false>(s, t);
+                ASSERT_EQ(path.empty(), !(dd[t] < Edge::maxWeight));
+                if (path.empty())
+                    continue;
+                real len {};
+                for (szt i {1}; i<path.size(); ++i)
+                    len += weight(path[i]);
+                ASSERT_DOUBLE_EQ(len, dd[t]);
+            }
+        }
+
+        // The classification is kept for the following searches:
+        ASSERT_EQ(c.details().weights.kind, kinds[j++]);
+    }
+}
+
 /*
 TEST_F(PathTest, OverEgIds)
 {
@@ -77,6 +77,8 @@ TEST_F(Pull_1, SingleLinChain_DrA)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     ASSERT_EQ(gr.cn[w], gr0.cn[w]);
@@ -140,6 +142,8 @@ TEST_F(Pull_1, SingleLinChain_DrB)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     ASSERT_EQ(gr.cn[w], gr0.cn[w]);
@@ -220,6 +224,8 @@ TEST_F(Pull_1, J3_DrA_SrLiA_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -337,6 +343,8 @@ TEST_F(Pull_1, J3_DrA_SrLiB_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -449,6 +457,8 @@ TEST_F(Pull_1, J3_DrB_SrLiA_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -561,6 +571,8 @@ TEST_F(Pull_1, J3_DrB_SrLiB_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -670,6 +682,8 @@ TEST_F(Pull_1, J3_DrA_SrLiA_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -771,6 +785,8 @@ TEST_F(Pull_1, J3_DrA_SrLiB_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -875,6 +891,8 @@ TEST_F(Pull_1, J3_DrB_SrLiB_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -978,6 +996,8 @@ TEST_F(Pull_1, J3_DrB_SrLiA_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1090,6 +1110,8 @@ TEST_F(Pull_1, J3_DrA_SrCyA_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1223,6 +1245,8 @@ TEST_F(Pull_1, J3_DrA_SrCyB_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1355,6 +1379,8 @@ TEST_F(Pull_1, J3_DrB_SrCyA_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1489,6 +1515,8 @@ TEST_F(Pull_1, J3_DrB_SrCyB_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1623,6 +1651,8 @@ TEST_F(Pull_1, J4_LinLin_DrA_SrLiA_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1753,6 +1783,8 @@ TEST_F(Pull_1, J4_LinLin_DrA_SrLiB_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1884,6 +1916,8 @@ TEST_F(Pull_1, J4_LinLin_DrB_SrLiB_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -2016,6 +2050,8 @@ TEST_F(Pull_1, J4_LinLin_DrB_SrLiA_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -2146,6 +2182,8 @@ TEST_F(Pull_1, J4_LinLin_DrA_SrLiA_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -2269,6 +2307,8 @@ TEST_F(Pull_1, J4_LinLin_DrA_SrLiB_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -2393,6 +2433,8 @@ TEST_F(Pull_1, J4_LinLin_DrB_SrLiB_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -2516,6 +2558,8 @@ TEST_F(Pull_1, J4_LinLin_DrB_SrLiA_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -2650,6 +2694,8 @@ TEST_F(Pull_1, J4_DrA_OutCyc_SrLiA_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -2777,6 +2823,8 @@ TEST_F(Pull_1, J4_DrA_OutCyc_SrLiB_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -2910,6 +2958,8 @@ TEST_F(Pull_1, J4_DrB_OutCyc_SrLiB_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -3037,6 +3087,8 @@ TEST_F(Pull_1, J4_DrB_OutCyc_SrLiA_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -3171,6 +3223,8 @@ TEST_F(Pull_1, J4_DrA_OutCyc_SrLiA_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -3289,6 +3343,8 @@ TEST_F(Pull_1, J4_DrA_OutCyc_SrLiB_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -3413,6 +3469,8 @@ TEST_F(Pull_1, J4_DrB_OutCyc_SrLiB_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -3530,6 +3588,8 @@ TEST_F(Pull_1, J4_DrB_OutCyc_SrLiA_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -3662,6 +3722,8 @@ TEST_F(Pull_1, J4_DrA_InCyAB_SrLiA_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -3812,6 +3874,8 @@ TEST_F(Pull_1, J4_DrA_InCyBA_SrLiA_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -3956,6 +4020,8 @@ TEST_F(Pull_1, J4_DrA_InCyAB_SrLiB_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -4098,6 +4164,8 @@ TEST_F(Pull_1, J4_DrA_InCyBA_SrLiB_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -4247,6 +4315,8 @@ TEST_F(Pull_1, J4_DrB_InCyAB_SrLiB_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -4397,6 +4467,8 @@ TEST_F(Pull_1, J4_DrB_InCyBA_SrLiB_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -4541,6 +4613,8 @@ TEST_F(Pull_1, J4_DrB_InCyAB_SrLiA_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -4683,6 +4757,8 @@ TEST_F(Pull_1, J4_DrB_InCyBA_SrLiA_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -4833,6 +4909,8 @@ TEST_F(Pull_1, J4_DrA_InCyAB_SrLiA_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -4974,6 +5052,8 @@ TEST_F(Pull_1, J4_DrA_InCyBA_SrLiA_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -5111,6 +5191,8 @@ TEST_F(Pull_1, J4_DrA_InCyAB_SrLiB_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -5246,6 +5328,8 @@ TEST_F(Pull_1, J4_DrA_InCyBA_SrLiB_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -5388,6 +5472,8 @@ TEST_F(Pull_1, J4_DrB_InCyAB_SrLiB_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -5529,6 +5615,8 @@ TEST_F(Pull_1, J4_DrB_InCyBA_SrLiB_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -5664,6 +5752,8 @@ TEST_F(Pull_1, J4_DrB_InCyAB_SrLiA_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -5757,6 +5847,8 @@ TEST_F(Pull_1, J4_DrB_InCyBA_SrLiA_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -5861,6 +5953,8 @@ TEST_F(Pull_1, J344_DrA_SrLiB_Srv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     ASSERT_EQ(gr.cn[w1].length(), 3);
@@ -5968,6 +6062,8 @@ TEST_F(Pull_1, J344_DrA_SrLiB_Rmv)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     ASSERT_EQ(gr.cn[w1].length(), 4);
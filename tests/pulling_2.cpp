@@ -76,6 +76,8 @@ TEST_F(Pull_2, Path1_Step1_SingleLinChain1A)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -161,6 +163,8 @@ TEST_F(Pull_2, Path1_Step1_SingleLinChain1B)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic =pp.cmp->ind;
@@ -247,6 +251,8 @@ TEST_F(Pull_2, Step1_PathMult_SingleLinChain_DrvInner_SrcA)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -347,6 +353,8 @@ TEST_F(Pull_2, StepFull_SingleLinChain_DrvInner_SrcA)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic =pp.cmp->ind;
@@ -434,6 +442,8 @@ TEST_F(Pull_2, Step1_SingleLinChain_DrvInner_SrcB)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic =pp.cmp->ind;
@@ -527,6 +537,8 @@ TEST_F(Pull_2, StepFull_SingleLinChain_DrvInner_SrcB)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic =pp.cmp->ind;
@@ -616,6 +628,8 @@ TEST_F(Pull_2, Junct3_LinDrvA_LinSrcA_SrcSurvives)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -718,6 +732,8 @@ TEST_F(Pull_2, Junct3_LinDrvB_LinSrcB_SrcSurvives)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -821,6 +837,8 @@ TEST_F(Pull_2, Junct3_LinDrvA_LinSrcB_SrcSurvives)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -924,6 +942,8 @@ TEST_F(Pull_2, Junct3_LinDrvB_LinSrcA_SrcSurvives)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1027,6 +1047,8 @@ TEST_F(Pull_2, Junct3_LinDrvA_LinSrcA_SrcConsumed)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1126,6 +1148,8 @@ TEST_F(Pull_2, Junct3_LinDrvB_LinSrcB_SrcConsumed)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1225,6 +1249,8 @@ TEST_F(Pull_2, Junct3_LinDrvA_LinSrcB_SrcConsumed)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1322,6 +1348,8 @@ TEST_F(Pull_2, Junct3_LinDrvB_LinSrcA_SrcConsumed)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1419,6 +1447,8 @@ TEST_F(Pull_2, Deg4junctionA)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1505,6 +1535,8 @@ TEST_F(Pull_2, Deg4junctionB)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1596,6 +1628,8 @@ TEST_F(Pull_2, Deg344junctionA)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1691,6 +1725,8 @@ TEST_F(Pull_2, Deg344junctionB)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1764,6 +1800,8 @@ TEST_F(Pull_2, Deg3junctionSrcRem)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1830,6 +1868,8 @@ TEST_F(Pull_2, Deg3junctionSrcRem_X)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     ASSERT_EQ(gr.ct.size(), 1);
@@ -1926,6 +1966,8 @@ TEST_F(Pull_2, Deg344junctionSrcRem)
         pp.print_detailed(tagAfter);
     }
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto& p = pp.pth;
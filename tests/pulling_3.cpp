@@ -89,6 +89,8 @@ TEST_F(Pull_3, DrLiA_SrLiB_SameCnDS_Survive)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -203,6 +205,8 @@ TEST_F(Pull_3, DrLiA_SrLiB_SameCnDS_Consume)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -324,6 +328,8 @@ TEST_F(Pull_3, DrLiB_SrLiA_SameCnDS_Survive)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -439,6 +445,8 @@ TEST_F(Pull_3, DrLiB_SrLiA_SameCnDS_Consume)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -565,6 +573,8 @@ TEST_F(Pull_3, DrLiA_SrLiB_OutCyc_SameCnDS_Survive)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -671,6 +681,8 @@ TEST_F(Pull_3, DrLiA_SrLiB_OutCyc_SameCnDS_Consume)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -793,6 +805,8 @@ TEST_F(Pull_3, DrLiB_SrLiA_OutCyc_SameCnDS_Survive)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -890,6 +904,8 @@ TEST_F(Pull_3, eB_OutCyc_Consume)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -981,6 +997,8 @@ TEST_F(Pull_3, DrCyA_SrLiB_Survive)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1002,7 +1020,7 @@ TEST_F(Pull_3, DrCyA_SrLiB_Survive)
     ASSERT_EQ(gr.cn[wS].g[0].ind, gr0.cn[wS].g[1].ind);
     ASSERT_EQ(gr.cn[v].g[0].ind, gr0.cn[wD].g[1].ind);
     ASSERT_EQ(gr.cn[v].g[1].ind, gr0.cn[wD].g[2].ind);
-    ASSERT_EQ(gr.cn[v].g[3].ind, gr0.cn[wS].g[0].ind);
+    ASSERT_EQ(gr.cn[v].g[2].ind, gr0.cn[wS].g[0].ind);
     ASSERT_EQ(gr.cn[wD].ngs[eD].num(), 0);
     ASSERT_EQ(gr.cn[wD].ngs[Ends::opp(eD)].num(), 3);
     ASSERT_EQ(gr.cn[wD].ngs[Ends::opp(eD)][0].w, v);
@@ -1112,6 +1130,8 @@ TEST_F(Pull_3, DrCyA_SrLiB_Consume)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -1242,6 +1262,8 @@ TEST_F(Pull_3, DrCyB_SrLiB_Survive)
     if constexpr (withMaxVerbosity)
         gr.print_components(tagAfter);
 
+    ASSERT_TRUE(gr.books_are_current());
+
     // Compare the result to the expectation.
 
     const auto ic = pp.cmp->ind;
@@ -2070,7 +2070,7 @@ TEST_F(VertexMergerTest, vm22_case_5)
     for (EgId i=0; i<gr.cn[w2].length(); ++i)
         ASSERT_EQ(gr.cn[w2].g[i].ind, v2[i]);
 
-    EgIds v3(len[w3]);
+    EgIds v3(len[w2] - a2);
     std::iota(v3.begin(), v3.end(), len[w1] + a2);
     for (EgId i=0; i<gr.cn[w3].length(); ++i)
         ASSERT_EQ(gr.cn[w3].g[i].ind, v3[i]);
@@ -2264,4 +2264,88 @@ TEST_F(VertexMergerTest, vm22_case_6)
 }
 
 
+/// Tests that the incrementally updated books match the full rebuild.
+TEST_F(VertexMergerTest, IncrementalBooks)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests that the incrementally updated books ",
+                          "match the full rebuild");
+
+    constexpr std::array<EgId, 5> len {4, 3, 3, 5, 2};
+
+    G gr;
+    for (const auto u : len)
+        gr.add_single_chain_component(u);
+    ASSERT_TRUE(gr.books_are_current());
+
+    VertexMerger<1, 2, G> merge12 {gr};
+    VertexMerger<1, 1, G> merge11 {gr};
+    VertexMerger<1, 3, G> merge13 {gr};
+
+    merge12(sA(0), BSlot{1, 1});  // produces cn[5]
+    ASSERT_TRUE(gr.books_are_current());
+
+    merge11(sB(3), sA(4));
+    ASSERT_TRUE(gr.books_are_current());
+
+    merge13(sB(2), sA(0));
+    ASSERT_TRUE(gr.books_are_current());
+
+    ASSERT_EQ(gr.template num_vertices<3>(), 0);
+    ASSERT_EQ(gr.template num_vertices<4>(), 1);
+}
+
+
+/// Tests that a batch of mergers updates the books once on commit
+TEST_F(VertexMergerTest, BatchedBooks)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests that a batch of mergers updates the books ",
+                          "once on commit");
+
+    constexpr std::array<EgId, 5> len {4, 3, 3, 5, 2};
+
+    G gr;
+    for (const auto u : len)
+        gr.add_single_chain_component(u);
+
+    VertexMerger<1, 2, G> merge12 {gr};
+    VertexMerger<1, 1, G> merge11 {gr};
+    VertexMerger<1, 3, G> merge13 {gr};
+
+    {
+        typename G::Batch batch {gr};
+
+        merge12(sA(0), BSlot{1, 1});  // produces cn[5]
+        merge11(sB(3), sA(4));
+        merge13(sB(2), sA(0));
+
+        // The graph-wide books are deferred:
+        ASSERT_EQ(gr.chis.cn11.size(), len.size());
+        ASSERT_FALSE(gr.vertices.is_current());
+        ASSERT_FALSE(gr.books_are_current());
+
+        // while the edge mappings are kept current:
+        for (EgId i {}; i<gr.edgenum; ++i)
+            ASSERT_EQ(gr.cn[gr.glm[i]].g[gr.gla[i]].ind, i);
+
+        // and the component adjacency is refreshed on access:
+        const auto& c = gr.ct[gr.cn[0].c];
+        auto ajlg = c.adjacency_list_edges();
+        for (auto& r: ajlg)
+            r.erase(std::unique(r.begin(), r.end()), r.end());
+        ASSERT_EQ(c.edge_adjacency(), ajlg);
+    }
+
+    ASSERT_TRUE(gr.books_are_current());
+
+    ASSERT_EQ(gr.template num_vertices<3>(), 0);
+    ASSERT_EQ(gr.template num_vertices<4>(), 1);
+}
+
+
 }  // namespace graph_mutator::tests::vertex_merger
@@ -19,9 +19,11 @@ limitations under the License.
 */
 
 #include <algorithm>
+#include <array>
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "common.h"
 #include "graph-mutator/structure/chain.h"
@@ -461,4 +463,68 @@ TEST_F(VertexMergerCoreTest, FuseToLoop)
 }
 
 
+TEST_F(VertexMergerCoreTest, StableChainIds)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests that merged chains are vacated ",
+                          "without relabeling other chains");
+
+    constexpr std::array len {4UL, 2UL, 1UL, 3UL};
+
+    Gr gr;
+    gr.keep_chain_ids = true;
+    Core core {gr};
+    for (const auto u : len)
+        gr.add_single_chain_component(u);
+
+    std::vector<Gr::ChainHandle> hh;
+    for (ChId w {}; w<gr.chain_num(); ++w)
+        hh.push_back(gr.handle(w));
+
+    core.parallel(0, 1);
+
+    // Chain 1 is vacated, while the others keep their indexes:
+    ASSERT_EQ(gr.chain_num(), len.size());
+    ASSERT_EQ(gr.cmpt_num(), len.size()-1);
+    ASSERT_EQ(gr.vacant, ChIds {1});
+    ASSERT_TRUE(gr.cn[1].is_vacant());
+    ASSERT_EQ(gr.cn[0].length(), len[0] + len[1]);
+    ASSERT_EQ(gr.cn[2].length(), len[2]);
+    ASSERT_EQ(gr.cn[3].length(), len[3]);
+    ASSERT_FALSE(gr.is_live(hh[1]));
+    for (const auto w: {0, 2, 3})
+        ASSERT_TRUE(gr.is_live(hh[w]));
+    ASSERT_TRUE(gr.books_are_current());
+
+    // A new chain takes the vacant slot:
+    gr.add_single_chain_component(5);
+    ASSERT_EQ(gr.chain_num(), len.size());
+    ASSERT_TRUE(gr.vacant.empty());
+    ASSERT_EQ(gr.cn[1].length(), 5);
+    ASSERT_EQ(gr.cn[1].c, gr.ind_last_cmpt());
+    ASSERT_FALSE(gr.is_live(hh[1]));
+    ASSERT_TRUE(gr.is_live(gr.handle(1)));
+    ASSERT_TRUE(gr.books_are_current());
+
+    core.parallel(0, 2);
+    ASSERT_EQ(gr.vacant, ChIds {2});
+
+    // Compaction moves the last chain into the vacant slot:
+    gr.compact_chains();
+    ASSERT_EQ(gr.chain_num(), len.size()-1);
+    ASSERT_TRUE(gr.vacant.empty());
+    ASSERT_TRUE(std::ranges::none_of(gr.cn, [](const auto& m)
+                                     { return m.is_vacant(); }));
+    ASSERT_EQ(gr.cn[2].length(), len[3]);
+    ASSERT_FALSE(gr.is_live(hh[3]));
+    ASSERT_TRUE(gr.is_live(hh[0]));
+    for (CmpId i {}; i<gr.cmpt_num(); ++i)
+        for (const auto w: gr.ct[i].ww)
+            ASSERT_EQ(gr.cn[w].c, i);
+    ASSERT_TRUE(gr.books_are_current());
+}
+
+
 }  // namespace graph_mutator::tests::vertex_merger_core
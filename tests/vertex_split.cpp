@@ -27,6 +27,8 @@ limitations under the License.
 #include "graph-mutator/structure/chain.h"
 #include "graph-mutator/structure/edge.h"
 #include "graph-mutator/structure/graph.h"
+#include "graph-mutator/structure/integral_tests.h"
+#include "graph-mutator/structure/paths/over_edges/generic.h"
 #include "graph-mutator/transforms/vertex_merger/from_00.h"
 #include "graph-mutator/transforms/vertex_merger/from_10.h"
 #include "graph-mutator/transforms/vertex_merger/from_11.h"
@@ -131,6 +133,7 @@ TEST_F(VertexSplitTest, Divide11_linA)
 
         VertexSplit<1, 1, G> divide {gr};
         divide(BSlot{w1, a});
+        ASSERT_TRUE(gr.books_are_current());
 
         ASSERT_EQ(gr.edgenum, len);
         ASSERT_EQ(gr.chain_num(), 2);
@@ -285,6 +288,7 @@ TEST_F(VertexSplitTest, Divide11_linB)
 
     VertexSplit<1, 1, G> divide {gr};
     divide(BSlot{w1, a1});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum);
     ASSERT_EQ(gr.chain_num(), 4);
@@ -382,6 +386,7 @@ TEST_F(VertexSplitTest, Divide11_cyc)
 
     VertexSplit<1, 1, G> divide {gr};
     divide(BSlot{w, 0});       // reverse by disconnecting at a = 0
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len);
     ASSERT_EQ(gr.chain_num(), 1);
@@ -470,6 +475,7 @@ TEST_F(VertexSplitTest, Divide11_dic)
 
     VertexSplit<1, 1, G> divide {gr};
     divide(BSlot{w, a});       // disconnect at a
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len);
     ASSERT_EQ(gr.chain_num(), 1);
@@ -568,6 +574,7 @@ TEST_F(VertexSplitTest, Divide12a)
 
     // reverse: disconnect u at end B
     divide(ESlot{u, eB});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -668,6 +675,7 @@ TEST_F(VertexSplitTest, Divide12b)
 
     // disconnect w at end A
     divide(ESlot{w, eA});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -761,6 +769,7 @@ TEST_F(VertexSplitTest, Divide12c)
           BSlot{w, a});
     // disconnect w from the loop end A
     divide(ESlot{w, eA});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len);
     ASSERT_EQ(gr.chain_num(), 1);
@@ -847,6 +856,7 @@ TEST_F(VertexSplitTest, Divide12d)
 
     // disconnect w from at the loop end B
     divide(ESlot{w, eB});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len);
     ASSERT_EQ(gr.chain_num(), 1);
@@ -934,6 +944,7 @@ TEST_F(VertexSplitTest, Divide10)
     VertexSplit<1, 0, G> divide {gr};
 
     divide(ESlot{v, eA});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -1047,6 +1058,7 @@ TEST_F(VertexSplitTest, Divide13a)
 
     // disconnect w3 at its end A
     divide(ESlot{w3, e});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum);
     ASSERT_EQ(gr.chain_num(), 4);
@@ -1182,6 +1194,7 @@ TEST_F(VertexSplitTest, Divide13b)
 
     // disconnect w2 at its end B
     divide(ESlot{w2, e});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum);
     ASSERT_EQ(gr.chain_num(), 4);
@@ -1312,6 +1325,7 @@ TEST_F(VertexSplitTest, Divide13c)
             BSlot{w1, a2});
 
     divide(ESlot{w3, e});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -1415,6 +1429,7 @@ TEST_F(VertexSplitTest, Divide13d)
     // disconnect the cycle chain at end B to produce linear chains connected
     // by a 3-way junction
     divide(ESlot{w3, e});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -1516,6 +1531,7 @@ TEST_F(VertexSplitTest, Divide13e)
 
     // disconnect the linear chain w1 at end B
     divide(ESlot{w1, e});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len);
     ASSERT_EQ(gr.chain_num(), 3);
@@ -1641,6 +1657,7 @@ TEST_F(VertexSplitTest, Divide13f)
     merge00(w1, w2);        // join the two cycles at their end vertices
 
     divide(ESlot{w1, e});    // disconnect end A of w1
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -1738,6 +1755,7 @@ TEST_F(VertexSplitTest, Divide13g)
     merge00(w1, w2);        // join the two cycles at their internal ends
 
     divide(ESlot{w1, e});    // disconnect end B of w1
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -1840,6 +1858,7 @@ TEST_F(VertexSplitTest, Divide22_4Lines_AA_BB)
 
     divide(ESlot{w5, e},
            ESlot{w6, e});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum);
     ASSERT_EQ(gr.chain_num(), 4);
@@ -1935,6 +1954,7 @@ TEST_F(VertexSplitTest, Divide22_4Lines_AB_AB)
 
     divide(ESlot{w6, eA},
            ESlot{w1, eB});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum);
     ASSERT_EQ(gr.chain_num(), 4);
@@ -2030,6 +2050,7 @@ TEST_F(VertexSplitTest, Divide22_4Lines_BB_AA)
 
     divide(ESlot{w1, e},
            ESlot{w3, e});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum);
     ASSERT_EQ(gr.chain_num(), 4);
@@ -2126,6 +2147,7 @@ TEST_F(VertexSplitTest, Divide22_2Lines_Cycle_AA_BB)
 
     divide(ESlot{w2, e},
            ESlot{w3, e});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len);
     ASSERT_EQ(gr.chain_num(), 1);
@@ -2211,6 +2233,7 @@ TEST_F(VertexSplitTest, Divide22_2Lines_Cycle_BB_AA)
 
     divide(ESlot{w1, e},
            ESlot{w3, e});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len);
     ASSERT_EQ(gr.chain_num(), 1);
@@ -2296,6 +2319,7 @@ TEST_F(VertexSplitTest, Divide22_2Lines_Cycle_AB_AB)
 
     divide(ESlot{w2, eA},
            ESlot{w3, eB});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len);
     ASSERT_EQ(gr.chain_num(), 1);
@@ -2378,6 +2402,7 @@ TEST_F(VertexSplitTest, Divide20_2Lines_Cycle1_AB_AB)
 
     divide(ESlot{w2, eA},
            ESlot{w1, eB});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -2496,6 +2521,7 @@ TEST_F(VertexSplitTest, Divide20_2Lines_Cycle2_AB_AB)
 
     divide(ESlot{w3, eA},
            ESlot{w3, eB});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, len);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -2605,6 +2631,7 @@ TEST_F(VertexSplitTest, Divide00_2Cycles)
 
     divide(ESlot{w1, eA},
            ESlot{w1, eB});
+    ASSERT_TRUE(gr.books_are_current());
 
     ASSERT_EQ(gr.edgenum, lensum);
     ASSERT_EQ(gr.chain_num(), 2);
@@ -2669,4 +2696,198 @@ TEST_F(VertexSplitTest, Divide00_2Cycles)
 }
 
 
+
+/// Tests that splits moving the smaller side give the default components.
+TEST_F(VertexSplitTest, SmallerSideSplits)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests that component splits moving the smaller ",
+                          "side produce the same components as the default ",
+                          "ones, differing only in their indexes");
+
+    // Chains of the component containing chain 'w', in ascending order:
+    const auto chains_with = [](const G& gr, const ChId w)
+    {
+        ChIds ww {gr.ct[gr.cn[w].c].ww};
+        std::ranges::sort(ww);
+        return ww;
+    };
+
+    // Splits graphs produced by 'make' by the default and the smaller-side
+    // splits, and compares the results:
+    const auto check = [&](const auto& make, const auto& divide)
+    {
+        G g0 {make()};
+        G g1 {make()};
+        g1.split_smaller_side = true;
+
+        divide(g0);
+        ASSERT_TRUE(g0.books_are_current());
+        divide(g1);
+        ASSERT_TRUE(g1.books_are_current());
+
+        ASSERT_EQ(g1.chain_num(), g0.chain_num());
+        ASSERT_EQ(g1.cmpt_num(), g0.cmpt_num());
+
+        for (ChId w {}; w<g0.chain_num(); ++w) {
+            const auto& c0 = g0.ct[g0.cn[w].c];
+            const auto& c1 = g1.ct[g1.cn[w].c];
+            ASSERT_EQ(chains_with(g1, w), chains_with(g0, w));
+            ASSERT_EQ(c1.num_edges(), c0.num_edges());
+            ASSERT_EQ(c1.chis.cn11, c0.chis.cn11);
+            ASSERT_EQ(c1.chis.cn22, c0.chis.cn22);
+            ASSERT_EQ(c1.chis.cn33.size(), c0.chis.cn33.size());
+            ASSERT_EQ(c1.chis.cn13.size(), c0.chis.cn13.size());
+            ASSERT_EQ(c1.chis.cn14.size(), c0.chis.cn14.size());
+            ASSERT_EQ(c1.chis.cn34.size(), c0.chis.cn34.size());
+        }
+
+        structure::IntegralTests<G> {g1}(0);
+    };
+
+    // Two chains joined at a 3-way junction: u B to v at 2.
+    const auto make12 = []
+    {
+        G gr;
+        gr.add_single_chain_component(4);
+        gr.add_single_chain_component(4);
+        VertexMerger<1, 2, G> merge12 {gr};
+        merge12(ESlot{0, eB}, BSlot{1, 2});
+        return gr;
+    };
+
+    check(make12, [](G& gr) { VertexSplit<1, 1, G> {gr}(BSlot{0, 2}); });
+    check(make12, [](G& gr) { VertexSplit<1, 2, G> {gr}(ESlot{0, eB}); });
+    check(make12, [](G& gr) { VertexSplit<1, 2, G> {gr}(ESlot{2, eA}); });
+
+    // Chain u alone lies beyond the junction, and forms the new component:
+    G gr {make12()};
+    gr.split_smaller_side = true;
+    VertexSplit<1, 2, G> {gr}(ESlot{0, eB});
+    ASSERT_EQ(gr.ct.back().ww, ChIds {0});
+
+    // Two chains joined at a 4-way junction:
+    const auto make22 = []
+    {
+        G gr;
+        gr.add_single_chain_component(4);
+        gr.add_single_chain_component(4);
+        VertexMerger<2, 2, G> merge22 {gr};
+        merge22(BSlot{0, 1}, BSlot{1, 3});
+        return gr;
+    };
+
+    check(make22, [](G& gr) { VertexSplit<1, 3, G> {gr}(ESlot{2, eA}); });
+    check(make22, [](G& gr) { VertexSplit<1, 3, G> {gr}(ESlot{1, eB}); });
+
+    // A chain closed into a cycle at a 4-way junction with its tails:
+    const auto make22c = []
+    {
+        G gr;
+        gr.add_single_chain_component(6);
+        VertexMerger<2, 2, G> merge22 {gr};
+        merge22(BSlot{0, 1}, BSlot{0, 3});
+        return gr;
+    };
+
+    check(make22c, [](G& gr) { VertexSplit<1, 3, G> {gr}(ESlot{0, eB}); });
+}
+
+
+/// Tests that splits inside a batch find the same components and paths
+/// as the unbatched ones
+TEST_F(VertexSplitTest, BatchedSplits)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests that splits inside a batch find the same ",
+                          "components and paths as the unbatched ones");
+
+    // Two chains over a 4-way junction, closed into a cycle by a third one:
+    const auto make = []
+    {
+        G gr;
+        gr.add_single_chain_component(4);
+        gr.add_single_chain_component(4);
+        gr.add_single_chain_component(5);
+        VertexMerger<2, 2, G> merge22 {gr};
+        merge22(BSlot{0, 1}, BSlot{1, 3});   // produces cn[3], cn[4]
+        VertexMerger<1, 2, G> merge12 {gr};
+        merge12(ESlot{2, eA}, BSlot{3, 1});  // produces cn[5]
+        merge12(ESlot{2, eB}, BSlot{1, 1});  // produces cn[6]
+        return gr;
+    };
+
+    // Shortest paths from the first edge of the component of chain 2:
+    const auto paths = [](const G& gr)
+    {
+        const auto& c = gr.ct[gr.cn[2].c];
+        structure::paths::over_edges::Generic<G::Cmpt> pp {&c};
+        const auto e1 = c.ind2indc(gr.cn[2].g[0].ind);
+        pp.compute_from_source(e1);
+        std::vector<szt> ll;
+        for (EgId e2 {}; e2<c.num_edges(); ++e2)
+            ll.push_back(pp.template find_shortest_path<false>(e1, e2).size());
+        return ll;
+    };
+
+    // The cached adjacency of each component matches the rebuilt one:
+    const auto adjacency_is_current = [](const G& gr)
+    {
+        for (const auto& c: gr.ct) {
+            auto ajlg = c.adjacency_list_edges();
+            for (auto& r: ajlg)
+                r.erase(std::unique(r.begin(), r.end()), r.end());
+            if (c.edge_adjacency() != ajlg)
+                return false;
+        }
+        return true;
+    };
+
+    G g0 {make()};
+    G g1 {make()};
+
+    ASSERT_EQ(g0.cn[3].ngs[eA].num(), 3);
+    ASSERT_EQ(g0.cn[2].ngs[eA].num(), 2);
+
+    VertexSplit<1, 3, G> {g0}(ESlot{3, eA});
+    VertexSplit<1, 2, G> {g0}(ESlot{2, eA});
+    const auto pp0 = paths(g0);
+
+    // The cached adjacency is built before the batch, to be patched inside:
+    ASSERT_TRUE(adjacency_is_current(g1));
+
+    {
+        typename G::Batch batch {g1};
+
+        VertexSplit<1, 3, G> {g1}(ESlot{3, eA});
+        ASSERT_TRUE(adjacency_is_current(g1));
+
+        VertexSplit<1, 2, G> {g1}(ESlot{2, eA});
+        ASSERT_TRUE(adjacency_is_current(g1));
+
+        ASSERT_EQ(paths(g1), pp0);
+    }
+
+    ASSERT_TRUE(g0.books_are_current());
+    ASSERT_TRUE(g1.books_are_current());
+    ASSERT_EQ(paths(g1), pp0);
+
+    ASSERT_EQ(g1.chain_num(), g0.chain_num());
+    ASSERT_EQ(g1.cmpt_num(), g0.cmpt_num());
+    for (ChId w {}; w<g0.chain_num(); ++w) {
+        ASSERT_EQ(g1.cn[w].length(), g0.cn[w].length());
+        ASSERT_EQ(g1.cn[w].c, g0.cn[w].c);
+    }
+    for (CmpId c {}; c<g0.cmpt_num(); ++c) {
+        ASSERT_EQ(g1.ct[c].ww, g0.ct[c].ww);
+        ASSERT_EQ(g1.ct[c].num_edges(), g0.ct[c].num_edges());
+    }
+
+    structure::IntegralTests<G> {g1}(0);
+}
+
 }  // namespace graph_mutator::tests::vertex_split
@@ -478,4 +478,109 @@ TEST_F(VerticesTest, CollectionAll)
 }
 
 
+/// Tests that vertex collections are rebuilt on access only
+TEST_F(VerticesTest, LazyMaterialization)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests that vertex collections are rebuilt on access only");
+
+    constexpr std::array<EgId, 2> len {3, 3};
+
+    constexpr ChId w0 {};
+
+    constexpr auto eA = Ends::A;
+    constexpr auto eB = Ends::B;
+
+    G gr;
+
+    for (const auto o : len)
+        gr.add_single_chain_component(o);
+
+    ASSERT_FALSE(gr.vertices.is_current());
+    ASSERT_EQ(gr.vertices.template num<1>(), 4);
+    ASSERT_TRUE(gr.vertices.is_current());
+
+    VertexMerger<1, 1, G> merge {gr};
+    merge(ESlot{w0, eA}, ESlot{w0, eB});
+
+    ASSERT_FALSE(gr.vertices.is_current());
+    ASSERT_EQ(gr.vertices.template num<0>(), 1);
+    ASSERT_TRUE(gr.vertices.is_current());
+    ASSERT_EQ(gr.vertices.template num<1>(), 2);
+    ASSERT_EQ(gr.vertices.template num<2>(), 4);
+}
+
+
+/// Tests slot-to-vertex lookup against the vertex slots
+TEST_F(VerticesTest, SlotLookup)
+{
+    ++testCount;
+
+    if constexpr (verboseT)
+        print_description("Tests slot-to-vertex lookup against the vertex slots");
+
+    constexpr std::array<EgId, 6> len {2, 4, 6, 3, 3, 3};
+
+    constexpr ChId w0 {};
+    constexpr ChId w1 {1};
+    constexpr ChId w2 {2};
+    constexpr ChId w3 {3};
+    constexpr ChId w4 {4};
+    constexpr ChId w5 {5};
+
+    constexpr EgId a1 {1};
+    constexpr EgId a2 {2};
+    constexpr EgId a3 {4};
+
+    constexpr auto eA = Ends::A;
+    constexpr auto eB = Ends::B;
+
+    G gr;
+
+    for (const auto o : len)
+        gr.add_single_chain_component(o);
+
+    VertexMerger<2, 2, G> merge_22 {gr};
+    merge_22(BSlot{w0, a1}, BSlot{w1, a2});
+    merge_22(BSlot{w2, a2}, BSlot{w2, a3});
+
+    VertexMerger<1, 2, G> merge_12 {gr};
+    merge_12(ESlot{w3, eB}, BSlot{w4, a1});
+
+    VertexMerger<1, 1, G> merge_11 {gr};
+    merge_11(ESlot{w5, eA}, ESlot{w5, eB});
+
+    const auto& all = gr.vertices;
+
+    ASSERT_EQ(all.num(), 23);
+
+    // The refreshes leave the vertex indexes to number():
+    all.number();
+
+    const auto check_end = [&](const auto& ns)
+    {
+        for (const auto& v: ns.vv)
+            for (const auto& s: v.ars)
+                ASSERT_EQ(all.from_end_slot(v.D, s), v.ind);
+    };
+
+    check_end(std::get<0>(all.all));
+    check_end(std::get<1>(all.all));
+    check_end(std::get<3>(all.all));
+    check_end(std::get<4>(all.all));
+
+    for (const auto& v: std::get<2>(all.all).vv)
+        ASSERT_EQ(all.from_bulk_slot(v.ars[1]), v.ind);
+
+    // Slots of the filtered collections are looked up by the linear search:
+    const auto all_c3_d3 = all.template for_compartment<3>(3);
+
+    ASSERT_TRUE(all_c3_d3.lookup.empty());
+    for (const auto& s: all_c3_d3.vv.front().ars)
+        ASSERT_EQ(find_vertex(s, all_c3_d3), all_c3_d3.vv.front().ind);
+}
+
+
 }  // namespace graph_mutator::tests::vertices